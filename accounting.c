@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "accounting.h"
+
+//Method that writes a column of the current block, nothing is written anymore once a write has failed (the error is
+//kept for the simulation)
+//parameters are the accounting file, the column, the size of a value and the number of values
+//returns nothing
+static void writeColumn(Accounting_t *accounting, const void *column, size_t size, int rows)
+{
+    if (accounting->error == 0 && fwrite(column, size, rows, accounting->file) != (size_t)rows)
+    {
+        accounting->error = errno != 0 ? errno : EIO;
+    }
+}
+
+//Method that writes the current block to the file and empties it
+//parameters are the accounting file
+//returns nothing
+static void writeBlock(Accounting_t *accounting)
+{
+    if (accounting->blockRows == 0)
+    {
+        return;
+    }
+
+    long long rows = accounting->blockRows;
+
+    writeColumn(accounting, &rows, sizeof(rows), 1);
+
+    //one column after the other, in the order of the AccountingRow_t fields
+    writeColumn(accounting, accounting->pid, sizeof(int), accounting->blockRows);
+    writeColumn(accounting, accounting->arrival_time, sizeof(int), accounting->blockRows);
+    writeColumn(accounting, accounting->first_run, sizeof(long long), accounting->blockRows);
+    writeColumn(accounting, accounting->finish, sizeof(long long), accounting->blockRows);
+    writeColumn(accounting, accounting->ready_wait, sizeof(long long), accounting->blockRows);
+    writeColumn(accounting, accounting->io_wait, sizeof(long long), accounting->blockRows);
+    writeColumn(accounting, accounting->dispatches, sizeof(int), accounting->blockRows);
+    writeColumn(accounting, accounting->preemptions, sizeof(int), accounting->blockRows);
+    writeColumn(accounting, accounting->partition_used, sizeof(int), accounting->blockRows);
+
+    accounting->blockRows = 0;
+}
+
+//Method that writes the header with the number of rows at the start of the file
+//parameters are the accounting file
+//returns nothing
+static void writeHeader(Accounting_t *accounting)
+{
+    AccountingHeader_t header;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ACCOUNTING_MAGIC, sizeof(header.magic));
+    header.version = ACCOUNTING_VERSION;
+    header.block_rows = ACCOUNTING_BLOCK_ROWS;
+    header.rows = accounting->rows;
+
+    fseek(accounting->file, 0, SEEK_SET);
+    writeColumn(accounting, &header, sizeof(header), 1);
+}
+
+Accounting_t *openAccounting(const char *accountingFile)
+{
+    Accounting_t *accounting = (Accounting_t *)malloc(sizeof(Accounting_t));
+
+    accounting->file = fopen(accountingFile, "wb");
+
+    //Check if file opened properly, errno says why it did not
+    if (accounting->file == NULL)
+    {
+        free(accounting);
+
+        return NULL;
+    }
+
+    accounting->rows = 0;
+    accounting->blockRows = 0;
+    accounting->error = 0;
+
+    accounting->pid = (int *)malloc(sizeof(int) * ACCOUNTING_BLOCK_ROWS);
+    accounting->arrival_time = (int *)malloc(sizeof(int) * ACCOUNTING_BLOCK_ROWS);
+    accounting->first_run = (long long *)malloc(sizeof(long long) * ACCOUNTING_BLOCK_ROWS);
+    accounting->finish = (long long *)malloc(sizeof(long long) * ACCOUNTING_BLOCK_ROWS);
+    accounting->ready_wait = (long long *)malloc(sizeof(long long) * ACCOUNTING_BLOCK_ROWS);
+    accounting->io_wait = (long long *)malloc(sizeof(long long) * ACCOUNTING_BLOCK_ROWS);
+    accounting->dispatches = (int *)malloc(sizeof(int) * ACCOUNTING_BLOCK_ROWS);
+    accounting->preemptions = (int *)malloc(sizeof(int) * ACCOUNTING_BLOCK_ROWS);
+    accounting->partition_used = (int *)malloc(sizeof(int) * ACCOUNTING_BLOCK_ROWS);
+
+    //the header is written again with the number of rows once the file is closed
+    writeHeader(accounting);
+
+    return accounting;
+}
+
+void recordAccounting(Accounting_t *accounting, process_t *process, long long finish)
+{
+    int row = accounting->blockRows++;
+
+    accounting->pid[row] = process->pid;
+    accounting->arrival_time[row] = process->arrival_time;
+    accounting->first_run[row] = process->first_run;
+    accounting->finish[row] = finish;
+    accounting->ready_wait[row] = process->ready_wait;
+    accounting->io_wait[row] = process->io_wait;
+    accounting->dispatches[row] = process->dispatches;
+    accounting->preemptions[row] = process->preemptions;
+    accounting->partition_used[row] = process->partition_used;
+
+    accounting->rows++;
+
+    if (accounting->blockRows == ACCOUNTING_BLOCK_ROWS)
+    {
+        writeBlock(accounting);
+    }
+}
+
+int closeAccounting(Accounting_t *accounting)
+{
+    writeBlock(accounting);
+    writeHeader(accounting);
+
+    if (fclose(accounting->file) != 0 && accounting->error == 0)
+    {
+        accounting->error = errno;
+    }
+
+    int error = accounting->error;
+
+    free(accounting->pid);
+    free(accounting->arrival_time);
+    free(accounting->first_run);
+    free(accounting->finish);
+    free(accounting->ready_wait);
+    free(accounting->io_wait);
+    free(accounting->dispatches);
+    free(accounting->preemptions);
+    free(accounting->partition_used);
+    free(accounting);
+
+    return error;
+}
+
+int getAccountingRowSize()
+{
+    return 5 * (int)sizeof(int) + 4 * (int)sizeof(long long);
+}
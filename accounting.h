@@ -0,0 +1,79 @@
+#ifndef ACCOUNTING_H
+#define ACCOUNTING_H
+
+#include <stdio.h>
+
+#include "process.h"
+
+/* ======================================================
+ * PROCESS ACCOUNTING IMPLEMENTATION
+ * ======================================================
+ */
+
+//First 8 bytes and version of an accounting file
+#define ACCOUNTING_MAGIC "SCHACCT\0"
+#define ACCOUNTING_VERSION 1
+
+//Number of processes in each block of an accounting file (the last block can have fewer)
+#define ACCOUNTING_BLOCK_ROWS 65536
+
+//Header at the start of an accounting file.
+//The file holds one row per TERMINATED process, in the order they terminated, in blocks of ACCOUNTING_BLOCK_ROWS
+//rows. A block starts with its number of rows (a long long) and then holds each column of the block one after the
+//other, in the order of the AccountingRow_t fields (4 byte columns for the int fields, 8 byte columns for the
+//long long fields), so a tool can map the file and scan a single column without reading the others.
+//Values are in the byte order of the machine, the header's version tells the reader if it matches.
+typedef struct AccountingHeader
+{
+    char magic[8];         // ACCOUNTING_MAGIC.
+    int version;           // ACCOUNTING_VERSION, also tells the byte order.
+    int block_rows;        // ACCOUNTING_BLOCK_ROWS.
+    long long rows;        // Number of rows in the file.
+} AccountingHeader_t;
+
+//The accounting of a process that terminated.
+typedef struct AccountingRow
+{
+    int pid;               // Process ID.
+    int arrival_time;      // Time of arrival.
+    long long first_run;   // Tick of the first dispatch.
+    long long finish;      // Tick the process terminated on.
+    long long ready_wait;  // Ticks spent READY.
+    long long io_wait;     // Ticks spent WAITING.
+    int dispatches;        // Number of dispatches.
+    int preemptions;       // Number of preemptions and timeouts (RUNNING to READY).
+    int partition_used;    // Memory partition the process used, -1 if none.
+} AccountingRow_t;
+
+//Accounting file being written, the rows of the current block are kept column by column until it is full.
+typedef struct Accounting
+{
+    FILE *file;                            // Accounting file.
+    long long rows;                        // Number of rows written so far.
+    int blockRows;                         // Number of rows in the current block.
+    int error;                             // errno of the first write that failed, 0 if none has.
+    int *pid;                              // Columns of the current block.
+    int *arrival_time;
+    long long *first_run;
+    long long *finish;
+    long long *ready_wait;
+    long long *io_wait;
+    int *dispatches;
+    int *preemptions;
+    int *partition_used;
+} Accounting_t;
+
+//Opens an accounting file for writing, returns NULL if it can not be opened.
+Accounting_t *openAccounting(const char *accountingFile);
+
+//Adds the row of a process that just terminated.
+void recordAccounting(Accounting_t *accounting, process_t *process, long long finish);
+
+//Writes the last block, the number of rows, and closes the file, returns 0 if everything was written and the errno of
+//the first failure otherwise.
+int closeAccounting(Accounting_t *accounting);
+
+//Returns the size in bytes of one row of every column (the size of a block is 8 plus rows times this).
+int getAccountingRowSize();
+
+#endif //ACCOUNTING_H
@@ -0,0 +1,238 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "loader.h"
+
+//Benchmark for loading the input file.
+//Times the original two-pass loader (countNumberOfProcesses then readInputFile) against the single-pass
+//loadProcesses on the same file, then checks that both loaded the same processes.
+//Without a file argument a workload of lines processes is generated into bench_loader_input.txt first.
+//
+//usage: bench_loader [lines] [input file]
+
+//default number of processes in the generated workload
+#define DEFAULT_LINES 1000000
+
+//function that returns the current time in nanoseconds
+static double now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+//method that writes a workload of lines processes with memory requirements into a file
+static void generate_input(const char *fileName, long lines)
+{
+    FILE *file = fopen(fileName, "w");
+
+    if (file == NULL)
+    {
+        perror("Could not create file.");
+        exit(1);
+    }
+
+    unsigned int state = 2463534242u;
+
+    for (long i = 0; i < lines; i++)
+    {
+        //small xorshift random number generator so every run loads the same workload
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        fprintf(file, "%ld %ld %u %u %u %u %u\n", i + 1, i / 4, 1 + state % 500, 1 + (state >> 9) % 100,
+                1 + (state >> 16) % 50, (state >> 20) % 10, 1 + (state >> 24) % 250);
+    }
+
+    fclose(file);
+}
+
+//The original two-pass loader (counts the lines, then re-reads them with fgets/strtok/atoi into 100 byte lines),
+//kept here to compare load times against loadProcesses. It exits on errors, so it is not part of the library.
+
+//Function to count the number of processes in the input file
+//parameter is a string of the name of the inputFile
+//returns the number of processes found in the input file (assuming each line represents a process)
+//ASSUMES : there is no blank lines in the input file
+static int countNumberOfProcesses(const char *inputFile)
+{
+    int processCtr = 0; // initializes process counter
+
+    FILE *file = fopen(inputFile, "r"); // opens input file in current working directory in read mode
+
+    if (file == NULL)
+    { //Checks for file if file opened properly
+        perror("Could not open file.");
+        exit(1);
+    }
+
+    char input_line[100]; // input buffer for reading from the file
+
+    //while loop that reads the input file (line by line) until the end of file is
+    while (fgets(input_line, sizeof(input_line), file))
+    {
+        processCtr++; //Increment process counter for each line read
+    }
+
+    //closes input file when finished
+    fclose(file);
+
+    //returns the number of processes found in the input file
+    return processCtr;
+}
+
+//function for reading and practing an input file
+//parameters are an array of processes , a string for the name of the input file, and the memory scheme
+//returns nothing
+//ASSUMES : there is no blank lines in the input file
+//If memory scheme is 0, ASSUMES no memory requirement for the processes
+static void readInputFile(process_t *processes, const char *inputFile, int memory_scheme)
+{
+    char str[100];                //To store the text contained in each line
+    const char truncate[2] = " "; //In-line separator
+    char *token;                  //To store the token for each line
+    int input_parameter = 0;      //To traverse through the different output parameters (i.e., execution time, etc.) Set to zero for first token
+    int process_position = 0;     //To traverse through the words in each line
+
+    FILE *file = fopen(inputFile, "r"); //Opens the input file within current working directory in read mode
+
+    // If file could not open, prints the error and exits
+    if (file == NULL)
+    {
+        perror("Could not open file.");
+        exit(1);
+    }
+
+    //while loop that keeps reading the file (line by line) until the end is reached, stores the contents of the line in str
+    while (fgets(str, sizeof(str), file))
+    {
+
+        token = strtok(str, truncate); //Break input into a series of tokens
+
+        while (token != NULL)
+        {
+            int int_token = atoi(token); //Converts string to integer representation
+
+            // if statements to set the members of the process struct according to the input from the file
+            if (input_parameter == 0)
+            {
+                processes[process_position].pid = int_token;
+            }
+            else if (input_parameter == 1)
+            {
+                processes[process_position].arrival_time = int_token;
+            }
+            else if (input_parameter == 2)
+            {
+                processes[process_position].total_CPU_time = int_token;
+            }
+            else if (input_parameter == 3)
+            {
+                processes[process_position].IO_frequency = int_token;
+            }
+            else if (input_parameter == 4)
+            {
+                processes[process_position].IO_duration = int_token;
+            }
+            else if (input_parameter == 5)
+            {
+                processes[process_position].initial_priority = int_token;
+            }
+            else if ( memory_scheme != 0 && input_parameter == 6)
+            {
+                processes[process_position].memory_needed = int_token;
+            }
+            else if (input_parameter == 7)
+            {
+                processes[process_position].relative_deadline = int_token;
+            }
+
+            token = strtok(NULL, truncate); //Reset token
+            input_parameter++;              //Increment input parameter position counter
+        }
+
+        //sets new processes to initially be in a NEW state
+        processes[process_position].state = NEW;
+
+        //initializes variables used to track cpu time, time until IO, and current IO duration
+        processes[process_position].current_CPU_time_needed = processes[process_position].total_CPU_time;
+        processes[process_position].current_time_until_IO_is_finished = processes[process_position].IO_duration;
+        processes[process_position].current_time_until_IO = processes[process_position].IO_frequency;
+        processes[process_position].effective_priority = processes[process_position].initial_priority;
+        processes[process_position].partition_used = -1;
+
+        input_parameter = 0; //Reset input parameter counter
+        process_position++;  //Increment the process position counter to point to the next process in the array of processes
+    }
+
+    //closes the input file
+    fclose(file);
+}
+
+//function that checks that two loaded processes have the same fields
+static int same_process(const process_t *a, const process_t *b)
+{
+    return a->pid == b->pid && a->arrival_time == b->arrival_time && a->total_CPU_time == b->total_CPU_time &&
+           a->IO_frequency == b->IO_frequency && a->IO_duration == b->IO_duration &&
+           a->initial_priority == b->initial_priority && a->memory_needed == b->memory_needed &&
+           a->current_CPU_time_needed == b->current_CPU_time_needed &&
+           a->current_time_until_IO == b->current_time_until_IO &&
+           a->current_time_until_IO_is_finished == b->current_time_until_IO_is_finished &&
+           a->effective_priority == b->effective_priority && a->partition_used == b->partition_used &&
+           a->state == b->state;
+}
+
+int main(int argc, char *argv[])
+{
+    long lines = argc > 1 ? atol(argv[1]) : DEFAULT_LINES;
+    const char *fileName = "bench_loader_input.txt";
+
+    if (argc > 2)
+    {
+        fileName = argv[2];
+    }
+    else
+    {
+        generate_input(fileName, lines);
+    }
+
+    //original loader: counts the lines, then parses them with fgets/strtok/atoi
+    double start = now_ns();
+    int legacyCount = countNumberOfProcesses(fileName);
+    process_t *legacy = (process_t *)calloc(legacyCount > 0 ? legacyCount : 1, sizeof(process_t));
+    readInputFile(legacy, fileName, 1);
+    double legacy_ms = (now_ns() - start) / 1e6;
+
+    //single pass loader over the mapped file
+    start = now_ns();
+    int count = 0;
+    char error[LOADER_ERROR_SIZE];
+    process_t *processes = loadProcesses(fileName, 1, &count, error);
+    double load_ms = (now_ns() - start) / 1e6;
+
+    if (processes == NULL)
+    {
+        fprintf(stderr, "%s\n", error);
+        return 1;
+    }
+
+    int same = legacyCount == count;
+
+    for (int i = 0; same && i < count; i++)
+    {
+        same = same_process(&legacy[i], &processes[i]);
+    }
+
+    printf("%-16s %12s %12s\n", "loader", "processes", "ms");
+    printf("%-16s %12d %12.1f\n", "fgets/strtok", legacyCount, legacy_ms);
+    printf("%-16s %12d %12.1f\n", "loadProcesses", count, load_ms);
+    printf("speedup %.1fx, same processes: %s\n", legacy_ms / load_ms, same ? "yes" : "NO");
+
+    free(legacy);
+    free(processes);
+
+    return same ? 0 : 1;
+}
@@ -0,0 +1,489 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+
+#include "queue.h"
+#include "fair_queue.h"
+#include "memory_manager.h"
+#include "memory_schemes.h"
+
+//Microbenchmarks of the scheduler's primitives, each measured on its own at steady state:
+//  enqueue / dequeue                       ready queue (FIFO) at depths 1 to 1M
+//  priority_enqueue, age_priority_queue    sorted priority queue at depths 1 to 1M
+//  priority_heap_enqueue / _dequeue,       binary heap priority queue at depths 1 to 1M (what the scheduler uses,
+//  age_priority_heap                       kept next to the sorted queue for comparison)
+//  fair_enqueue / fair_dequeue             red-black tree of the completely fair scheduler at depths 1 to 1M
+//  memory_manager ALLOCATE / FREE          both memory schemes, with 0 to 3 partitions already in use
+//The queue stays at its depth: operations run in chunks of up to CHUNK (a chunk of one operation, then a chunk of the
+//operation that undoes it), and each chunk is timed on its own with the cost of reading the clock taken out.
+//Every benchmark runs SAMPLES samples (after a warm up that picks the number of chunks per sample), and reports the
+//mean, standard deviation and minimum ns/op over the samples, and the heap allocations per op.
+//
+//usage: bench_primitives [--json] [--max-depth=N]
+
+//operations per timed chunk (fewer on shallower queues)
+#define CHUNK 64
+
+//number of samples of every benchmark
+#define SAMPLES 11
+
+//length a sample is warmed up to, in nanoseconds
+#define SAMPLE_NS 2e6
+
+//number of different priorities the processes get (0 to PRIORITY_LEVELS - 1)
+#define PRIORITY_LEVELS 10
+
+/* ======================================================
+ * ALLOCATION COUNTING
+ * ======================================================
+ */
+
+//number of heap allocations (malloc, calloc and realloc calls) made by the code under test
+static long long allocations = 0;
+
+#ifdef COUNT_ALLOCATIONS
+//the linker sends the allocations of the code under test here (-Wl,--wrap=malloc and so on)
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *pointer, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    allocations++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *pointer, size_t size)
+{
+    allocations++;
+    return __real_realloc(pointer, size);
+}
+#endif
+
+/* ======================================================
+ * BENCHMARKS
+ * ======================================================
+ */
+
+//A benchmark of one or two operations of a primitive, set up at a depth
+typedef struct Bench
+{
+    const char *operations[2];                  // Names of the operations measured, the second is NULL if there is one.
+    void (*setup)(struct Bench *bench);         // Builds the structure at the depth.
+    void (*chunk)(struct Bench *bench, int count, double elapsed[2], long long allocated[2]); // Runs count of each op.
+    void (*teardown)(struct Bench *bench);      // Frees the structure.
+    int depth;                                  // Depth of the queue, or partitions in use for the memory manager.
+    int memory_scheme;                          // Memory scheme of the memory manager benchmarks.
+    process_t *processes;                       // Processes in the structure.
+    Queue_t *queue;                             // Queue under test (ready queue or sorted priority queue).
+    PriorityQueue_t *heap;                      // Heap under test.
+    FairQueue_t *fair;                          // Red-black tree under test.
+    int partitions[NUMBER_OF_PARTITIONS][2];    // Partitions under test.
+    unsigned int seed;                          // State of the random priorities.
+} Bench_t;
+
+//cost of reading the clock twice, taken out of every timed chunk
+static double clock_overhead_ns = 0;
+
+//function that returns the current time in nanoseconds
+static double now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+//small xorshift random number generator so every run sees the same priorities
+static unsigned int next_random(unsigned int *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+//function that returns the number of operations in a chunk at a depth (at least one, at most the whole queue)
+static int chunk_size(int depth)
+{
+    if (depth < 1)
+    {
+        return 1;
+    }
+
+    return depth < CHUNK ? depth : CHUNK;
+}
+
+//macro that times a block of code and count its allocations into slot k of elapsed and allocated
+#define TIMED(k, block)                                                   \
+    do                                                                    \
+    {                                                                     \
+        long long allocations_before = allocations;                      \
+        double start = now_ns();                                          \
+        block;                                                            \
+        elapsed[k] += now_ns() - start - clock_overhead_ns;               \
+        allocated[k] += allocations - allocations_before;                \
+    } while (0)
+
+//ready queue: enqueue and dequeue
+static void setup_fifo(Bench_t *bench)
+{
+    bench->processes = (process_t *)calloc(bench->depth, sizeof(process_t));
+    bench->queue = initReadyQueue();
+
+    for (int i = 0; i < bench->depth; i++)
+    {
+        enqueue(bench->queue, &bench->processes[i]);
+    }
+}
+
+static void chunk_fifo(Bench_t *bench, int count, double elapsed[2], long long allocated[2])
+{
+    TIMED(0, for (int i = 0; i < count; i++) { enqueue(bench->queue, &bench->processes[i]); });
+    TIMED(1, for (int i = 0; i < count; i++) { dequeue(bench->queue); });
+}
+
+static void teardown_fifo(Bench_t *bench)
+{
+    cleanReadyQueue(bench->queue);
+    free(bench->processes);
+}
+
+//sorted priority queue: priority_enqueue (after untimed dequeues), and age_priority_queue on its own
+//the processes are appended in priority order, which builds the same queue priority_enqueue would
+static void setup_sorted(Bench_t *bench)
+{
+    bench->processes = (process_t *)calloc(bench->depth, sizeof(process_t));
+    bench->queue = initReadyQueue();
+
+    for (int i = 0; i < bench->depth; i++)
+    {
+        bench->processes[i].effective_priority = (int)((long long)i * PRIORITY_LEVELS / bench->depth);
+        enqueue(bench->queue, &bench->processes[i]);
+    }
+}
+
+static void chunk_sorted(Bench_t *bench, int count, double elapsed[2], long long allocated[2])
+{
+    process_t *taken[CHUNK];
+
+    for (int i = 0; i < count; i++)
+    {
+        taken[i] = dequeue(bench->queue);
+        taken[i]->effective_priority = next_random(&bench->seed) % PRIORITY_LEVELS;
+    }
+
+    TIMED(0, for (int i = 0; i < count; i++) { priority_enqueue(bench->queue, taken[i]); });
+}
+
+static void chunk_sorted_aging(Bench_t *bench, int count, double elapsed[2], long long allocated[2])
+{
+    TIMED(0, for (int i = 0; i < count; i++) { age_priority_queue(bench->queue); });
+}
+
+//binary heap: priority_heap_enqueue, priority_heap_dequeue and age_priority_heap
+static void setup_heap(Bench_t *bench)
+{
+    bench->processes = (process_t *)calloc(bench->depth, sizeof(process_t));
+    bench->heap = initPriorityQueue();
+
+    for (int i = 0; i < bench->depth; i++)
+    {
+        bench->processes[i].effective_priority = next_random(&bench->seed) % PRIORITY_LEVELS;
+        priority_heap_enqueue(bench->heap, &bench->processes[i]);
+    }
+}
+
+static void chunk_heap(Bench_t *bench, int count, double elapsed[2], long long allocated[2])
+{
+    process_t *taken[CHUNK];
+
+    TIMED(1, for (int i = 0; i < count; i++) { taken[i] = priority_heap_dequeue(bench->heap); });
+
+    for (int i = 0; i < count; i++)
+    {
+        taken[i]->effective_priority = next_random(&bench->seed) % PRIORITY_LEVELS;
+    }
+
+    TIMED(0, for (int i = 0; i < count; i++) { priority_heap_enqueue(bench->heap, taken[i]); });
+}
+
+static void chunk_heap_aging(Bench_t *bench, int count, double elapsed[2], long long allocated[2])
+{
+    TIMED(0, for (int i = 0; i < count; i++) { age_priority_heap(bench->heap, 1); });
+}
+
+static void teardown_heap(Bench_t *bench)
+{
+    cleanPriorityQueue(bench->heap);
+    free(bench->processes);
+}
+
+//red-black tree: fair_enqueue and fair_dequeue, a dequeued process goes back in after running for a random time
+static void setup_fair(Bench_t *bench)
+{
+    bench->processes = (process_t *)calloc(bench->depth, sizeof(process_t));
+    bench->fair = initFairQueue();
+
+    for (int i = 0; i < bench->depth; i++)
+    {
+        bench->processes[i].vruntime = next_random(&bench->seed) % (FAIR_NICE_0_WEIGHT * 100);
+        fair_enqueue(bench->fair, &bench->processes[i]);
+    }
+}
+
+static void chunk_fair(Bench_t *bench, int count, double elapsed[2], long long allocated[2])
+{
+    process_t *taken[CHUNK];
+
+    TIMED(1, for (int i = 0; i < count; i++) { taken[i] = fair_dequeue(bench->fair); });
+
+    for (int i = 0; i < count; i++)
+    {
+        taken[i]->vruntime += next_random(&bench->seed) % (FAIR_NICE_0_WEIGHT * 100);
+    }
+
+    TIMED(0, for (int i = 0; i < count; i++) { fair_enqueue(bench->fair, taken[i]); });
+}
+
+static void teardown_fair(Bench_t *bench)
+{
+    cleanFairQueue(bench->fair);
+    free(bench->processes);
+}
+
+//memory manager: ALLOCATE then FREE of one process, with depth partitions already in use (the first ones, so the
+//first fit scan walks past them)
+static void setup_memory(Bench_t *bench)
+{
+    bench->processes = (process_t *)calloc(NUMBER_OF_PARTITIONS, sizeof(process_t));
+
+    for (int i = 0; i < NUMBER_OF_PARTITIONS; i++)
+    {
+        bench->partitions[i][0] = bench->memory_scheme == 1 ? MEMORY_SCHEME_1[i][0] : MEMORY_SCHEME_2[i][0];
+        bench->partitions[i][1] = -1;
+    }
+
+    for (int i = 0; i < bench->depth; i++)
+    {
+        bench->processes[i].memory_needed = 1;
+        memory_manager(bench->partitions, ALLOCATE, &bench->processes[i], bench->memory_scheme);
+    }
+
+    //the process allocated and freed by the benchmark fits in any partition of both schemes
+    bench->processes[NUMBER_OF_PARTITIONS - 1].memory_needed = 1;
+}
+
+static void chunk_memory(Bench_t *bench, int count, double elapsed[2], long long allocated[2])
+{
+    process_t *process = &bench->processes[NUMBER_OF_PARTITIONS - 1];
+
+    for (int i = 0; i < count; i++)
+    {
+        TIMED(0, memory_manager(bench->partitions, ALLOCATE, process, bench->memory_scheme));
+        TIMED(1, memory_manager(bench->partitions, FREE, process, bench->memory_scheme));
+    }
+}
+
+static void teardown_memory(Bench_t *bench)
+{
+    free(bench->processes);
+}
+
+/* ======================================================
+ * DRIVER
+ * ======================================================
+ */
+
+//method that measures the cost of reading the clock twice
+static void calibrate_clock()
+{
+    double best = 1e9;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        double start = now_ns();
+        double end = now_ns();
+
+        if (end - start < best)
+        {
+            best = end - start;
+        }
+    }
+
+    clock_overhead_ns = best;
+}
+
+//method that runs a benchmark at a depth and prints a line for each of its operations
+static void run_bench(Bench_t *bench, const char *label, bool json)
+{
+    int count = chunk_size(bench->depth);
+    double elapsed[2];
+    long long allocated[2];
+
+    bench->seed = 2463534242u;
+    bench->setup(bench);
+
+    //warm up, doubling the chunks of a sample until a sample takes long enough
+    long chunks = 1;
+
+    while (true)
+    {
+        double start = now_ns();
+
+        for (long c = 0; c < chunks; c++)
+        {
+            bench->chunk(bench, count, elapsed, allocated);
+        }
+
+        if (now_ns() - start >= SAMPLE_NS || chunks >= (1L << 24))
+        {
+            break;
+        }
+
+        chunks *= 2;
+    }
+
+    //ns/op of every sample, and the allocations of all of them
+    double samples[2][SAMPLES];
+    long long totalAllocated[2] = {0, 0};
+    long long opsPerSample = chunks * count;
+
+    for (int s = 0; s < SAMPLES; s++)
+    {
+        elapsed[0] = elapsed[1] = 0;
+        allocated[0] = allocated[1] = 0;
+
+        for (long c = 0; c < chunks; c++)
+        {
+            bench->chunk(bench, count, elapsed, allocated);
+        }
+
+        for (int k = 0; k < 2; k++)
+        {
+            samples[k][s] = elapsed[k] / opsPerSample;
+            totalAllocated[k] += allocated[k];
+        }
+    }
+
+    bench->teardown(bench);
+
+    for (int k = 0; k < 2 && bench->operations[k] != NULL; k++)
+    {
+        double mean = 0, min = samples[k][0], variance = 0;
+
+        for (int s = 0; s < SAMPLES; s++)
+        {
+            mean += samples[k][s] / SAMPLES;
+            min = samples[k][s] < min ? samples[k][s] : min;
+        }
+
+        for (int s = 0; s < SAMPLES; s++)
+        {
+            variance += (samples[k][s] - mean) * (samples[k][s] - mean) / (SAMPLES - 1);
+        }
+
+        double allocationsPerOp = (double)totalAllocated[k] / ((double)opsPerSample * SAMPLES);
+
+        if (json)
+        {
+            printf("{\"operation\":\"%s\",\"%s\":%d,\"ops_per_sample\":%lld,\"samples\":%d,\"mean_ns\":%.3f,"
+                   "\"stddev_ns\":%.3f,\"min_ns\":%.3f,\"allocations_per_op\":",
+                   bench->operations[k], label, bench->depth, opsPerSample, SAMPLES, mean, sqrt(variance), min);
+#ifdef COUNT_ALLOCATIONS
+            printf("%.6f}\n", allocationsPerOp);
+#else
+            printf("null}\n");
+#endif
+        }
+        else
+        {
+            printf("%-26s %-8s %8d %12lld %10.1f %10.1f %10.1f ", bench->operations[k], label, bench->depth,
+                   opsPerSample, mean, sqrt(variance), min);
+#ifdef COUNT_ALLOCATIONS
+            printf("%12.6f\n", allocationsPerOp);
+#else
+            printf("%12s\n", "n/a");
+#endif
+        }
+
+        fflush(stdout);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bool json = false;
+    int maxDepth = 1000000;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0)
+        {
+            json = true;
+        }
+        else if (strncmp(argv[i], "--max-depth=", 12) == 0)
+        {
+            maxDepth = atoi(argv[i] + 12);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--max-depth=N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    calibrate_clock();
+
+    if (!json)
+    {
+        printf("%-26s %-8s %8s %12s %10s %10s %10s %12s\n", "operation", "", "depth", "ops/sample", "mean ns", "stddev",
+               "min ns", "allocs/op");
+    }
+
+    for (int depth = 1; depth <= maxDepth; depth *= 10)
+    {
+        Bench_t fifo = {.operations = {"enqueue", "dequeue"}, .setup = setup_fifo, .chunk = chunk_fifo,
+                        .teardown = teardown_fifo, .depth = depth};
+        Bench_t sorted = {.operations = {"priority_enqueue", NULL}, .setup = setup_sorted, .chunk = chunk_sorted,
+                          .teardown = teardown_fifo, .depth = depth};
+        Bench_t sortedAging = {.operations = {"age_priority_queue", NULL}, .setup = setup_sorted,
+                               .chunk = chunk_sorted_aging, .teardown = teardown_fifo, .depth = depth};
+        Bench_t heap = {.operations = {"priority_heap_enqueue", "priority_heap_dequeue"}, .setup = setup_heap,
+                        .chunk = chunk_heap, .teardown = teardown_heap, .depth = depth};
+        Bench_t heapAging = {.operations = {"age_priority_heap", NULL}, .setup = setup_heap, .chunk = chunk_heap_aging,
+                             .teardown = teardown_heap, .depth = depth};
+        Bench_t fair = {.operations = {"fair_enqueue", "fair_dequeue"}, .setup = setup_fair, .chunk = chunk_fair,
+                        .teardown = teardown_fair, .depth = depth};
+
+        run_bench(&fifo, "depth", json);
+        run_bench(&sorted, "depth", json);
+        run_bench(&sortedAging, "depth", json);
+        run_bench(&heap, "depth", json);
+        run_bench(&heapAging, "depth", json);
+        run_bench(&fair, "depth", json);
+    }
+
+    for (int memory_scheme = 1; memory_scheme <= 2; memory_scheme++)
+    {
+        for (int used = 0; used < NUMBER_OF_PARTITIONS; used++)
+        {
+            Bench_t memory = {.operations = {memory_scheme == 1 ? "memory_manager_1 ALLOCATE" : "memory_manager_2 ALLOCATE",
+                                             memory_scheme == 1 ? "memory_manager_1 FREE" : "memory_manager_2 FREE"},
+                              .setup = setup_memory, .chunk = chunk_memory, .teardown = teardown_memory,
+                              .depth = used, .memory_scheme = memory_scheme};
+
+            run_bench(&memory, "used", json);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,206 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "queue.h"
+
+//Benchmark for the priority scheduler's ready queue.
+//For every queue depth the queue is filled with that many ready processes, then a steady stream of operations
+//dequeues the highest priority process and enqueues it again with a new priority, the same way the
+//scheduler cycles processes through the ready queue. Both the sorted queue (priority_enqueue/dequeue)
+//and the binary heap (priority_heap_enqueue/priority_heap_dequeue) run the same stream of priorities.
+//
+//usage: bench_ready_queue [operations]
+
+//number of different priorities the processes get (0 to PRIORITY_LEVELS - 1)
+#define PRIORITY_LEVELS 10
+
+//the order check also gives negative priorities (-NEGATIVE_PRIORITIES to -1), and ages both queues every
+//AGING_EVERY operations
+#define NEGATIVE_PRIORITIES 5
+#define AGING_EVERY 4
+
+//function that returns the current time in nanoseconds
+static double now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+//small xorshift random number generator so both queues see the same priorities
+static unsigned int next_random(unsigned int *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+//function that fills the sorted queue with depth processes, spread evenly over the priorities
+//the processes are already in priority order, so appending them with enqueue builds the same queue
+//priority_enqueue would, without the setup itself taking O(n^2)
+static void fill_list(Queue_t *queue, process_t *processes, int depth)
+{
+    for (int i = 0; i < depth; i++)
+    {
+        processes[i].effective_priority = (int)((long long)i * PRIORITY_LEVELS / depth);
+        enqueue(queue, &processes[i]);
+    }
+}
+
+//function that fills the heap with the same processes as fill_list
+static void fill_heap(PriorityQueue_t *queue, process_t *processes, int depth)
+{
+    for (int i = 0; i < depth; i++)
+    {
+        processes[i].effective_priority = (int)((long long)i * PRIORITY_LEVELS / depth);
+        priority_heap_enqueue(queue, &processes[i]);
+    }
+}
+
+//function that runs the operations on the sorted queue
+//returns the nanoseconds per operation (one dequeue and one enqueue)
+static double run_list(int depth, long operations, unsigned int seed)
+{
+    process_t *processes = (process_t *)calloc(depth, sizeof(process_t));
+    Queue_t *queue = initReadyQueue();
+
+    fill_list(queue, processes, depth);
+
+    double start = now_ns();
+
+    for (long i = 0; i < operations; i++)
+    {
+        process_t *process = dequeue(queue);
+        process->effective_priority = next_random(&seed) % PRIORITY_LEVELS;
+        priority_enqueue(queue, process);
+    }
+
+    double elapsed = now_ns() - start;
+
+    cleanReadyQueue(queue);
+    free(processes);
+
+    return elapsed / operations;
+}
+
+//function that runs the operations on the heap
+//returns the nanoseconds per operation (one dequeue and one enqueue)
+static double run_heap(int depth, long operations, unsigned int seed)
+{
+    process_t *processes = (process_t *)calloc(depth, sizeof(process_t));
+    PriorityQueue_t *queue = initPriorityQueue();
+
+    fill_heap(queue, processes, depth);
+
+    double start = now_ns();
+
+    for (long i = 0; i < operations; i++)
+    {
+        process_t *process = priority_heap_dequeue(queue);
+        process->effective_priority = next_random(&seed) % PRIORITY_LEVELS;
+        priority_heap_enqueue(queue, process);
+    }
+
+    double elapsed = now_ns() - start;
+
+    cleanPriorityQueue(queue);
+    free(processes);
+
+    return elapsed / operations;
+}
+
+//function that checks both queues hand out the processes in the same order for the same operations
+//returns 1 if they match and 0 otherwise
+static int same_order(int depth, long operations, unsigned int seed)
+{
+    process_t *list_processes = (process_t *)calloc(depth, sizeof(process_t));
+    process_t *heap_processes = (process_t *)calloc(depth, sizeof(process_t));
+    Queue_t *list = initReadyQueue();
+    PriorityQueue_t *heap = initPriorityQueue();
+    unsigned int list_seed = seed;
+    unsigned int heap_seed = seed;
+    int matches = 1;
+
+    for (int i = 0; i < depth; i++)
+    {
+        list_processes[i].pid = heap_processes[i].pid = i;
+    }
+
+    fill_list(list, list_processes, depth);
+    fill_heap(heap, heap_processes, depth);
+
+    for (long i = 0; i < operations + depth && matches; i++)
+    {
+        process_t *from_list = dequeue(list);
+        process_t *from_heap = priority_heap_dequeue(heap);
+
+        matches = from_list->pid == from_heap->pid;
+
+        if (i < operations)
+        {
+            //negative priorities are never aged and go ahead of every aged process
+            from_list->effective_priority = (int)(next_random(&list_seed) % (PRIORITY_LEVELS + NEGATIVE_PRIORITIES)) - NEGATIVE_PRIORITIES;
+            from_heap->effective_priority = (int)(next_random(&heap_seed) % (PRIORITY_LEVELS + NEGATIVE_PRIORITIES)) - NEGATIVE_PRIORITIES;
+            priority_enqueue(list, from_list);
+            priority_heap_enqueue(heap, from_heap);
+
+            //both queues are aged every few operations, like the scheduler does
+            if (i % AGING_EVERY == 0)
+            {
+                age_priority_queue(list);
+                age_priority_heap(heap, 1);
+            }
+        }
+    }
+
+    cleanReadyQueue(list);
+    cleanPriorityQueue(heap);
+    free(list_processes);
+    free(heap_processes);
+
+    return matches;
+}
+
+int main(int argc, char *argv[])
+{
+    //number of operations on the heap, the sorted queue gets fewer on deep queues so it finishes in reasonable time
+    long operations = argc > 1 ? atol(argv[1]) : 1000000;
+
+    const int depths[] = {1000, 100000, 1000000};
+
+    if (!same_order(1000, 10000, 12345))
+    {
+        fprintf(stderr, "sorted queue and heap dequeued processes in a different order\n");
+        return 1;
+    }
+
+    printf("%-10s %-12s %-12s %-12s %-12s %s\n", "depth", "sorted ops", "sorted ns/op", "heap ops", "heap ns/op", "speedup");
+
+    for (int i = 0; i < 3; i++)
+    {
+        int depth = depths[i];
+
+        //the sorted queue moves about half the queue per enqueue, so its operation count is capped
+        long list_operations = operations;
+
+        if (list_operations * depth > 200000000L)
+        {
+            list_operations = 200000000L / depth;
+        }
+
+        if (list_operations < 10)
+        {
+            list_operations = 10;
+        }
+
+        double list_ns = run_list(depth, list_operations, 42);
+        double heap_ns = run_heap(depth, operations, 42);
+
+        printf("%-10d %-12ld %-12.1f %-12ld %-12.1f %.1fx\n", depth, list_operations, list_ns, operations, heap_ns, list_ns / heap_ns);
+    }
+
+    return 0;
+}
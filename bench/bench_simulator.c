@@ -0,0 +1,319 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+#include "simulator.h"
+#include "workload.h"
+
+//End-to-end benchmark of the simulator.
+//Generates a workload (workload.h, default parameters) of every size once, then runs every mode and memory scheme on
+//it, each run in its own child process so its peak RSS can be measured on its own. Transitions are not written
+//(--trace=none), so the numbers are the simulator's. Prints the load time, run time, simulated ticks per second,
+//transitions per second and peak RSS of every run as JSON.
+//
+//usage: bench_simulator [--sizes=1000,100000,10000000] [--modes=1,2,3] [--schemes=1,2] [--engine=event|tick]
+//                       [--seed=N] [--workload-dir=DIR] [--output=FILE]
+
+//most values a list option can hold
+#define MAX_VALUES 16
+
+//Result of one run, sent by the child process that ran it to the benchmark through a pipe
+typedef struct RunResult
+{
+    long long processes;  // Number of processes loaded.
+    double load_seconds;  // Time to load the input file and sort it by arrival.
+    double run_seconds;   // Time to run the simulation to completion.
+    long long ticks;      // Simulated ticks (the clock at the end of the run).
+    long long transitions; // State transitions.
+} RunResult_t;
+
+//function that returns the current time in seconds
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//function that reads a comma separated list of numbers, exits if it is not one
+static int parseList(const char *option, const char *text, long long *values)
+{
+    int count = 0;
+    const char *current = text;
+
+    while (count < MAX_VALUES)
+    {
+        char *end;
+        values[count++] = strtoll(current, &end, 10);
+
+        if (end == current || (*end != ',' && *end != '\0'))
+        {
+            break;
+        }
+
+        if (*end == '\0')
+        {
+            return count;
+        }
+
+        current = end + 1;
+    }
+
+    fprintf(stderr, "%s expects a comma separated list of at most %d numbers\n", option, MAX_VALUES);
+    exit(1);
+}
+
+//method that generates the workload of a size into the workload directory, unless it was generated before
+static void prepareWorkload(const char *fileName, long long size, unsigned long long seed)
+{
+    struct stat status;
+
+    if (stat(fileName, &status) == 0)
+    {
+        return;
+    }
+
+    WorkloadParameters_t parameters;
+
+    defaultWorkloadParameters(&parameters);
+    parameters.seed = seed;
+
+    //written under a temporary name first so an interrupted generation is not reused
+    char temporary[4096];
+
+    if (snprintf(temporary, sizeof(temporary), "%s.tmp", fileName) >= (int)sizeof(temporary))
+    {
+        fprintf(stderr, "workload file name too long: %s\n", fileName);
+        exit(1);
+    }
+
+    FILE *file = fopen(temporary, "w");
+
+    if (file == NULL)
+    {
+        perror("Could not create file.");
+        exit(1);
+    }
+
+    generateWorkload(file, size, &parameters);
+    fclose(file);
+
+    if (rename(temporary, fileName) != 0)
+    {
+        perror("Could not rename file.");
+        exit(1);
+    }
+}
+
+//function that runs a simulation in a child process
+//returns the result of the run, and sets peak_rss_kb to the peak RSS of the child
+static RunResult_t runChild(const char *fileName, int mode, int memory_scheme, Engines engine, long *peak_rss_kb)
+{
+    int pipeEnds[2];
+
+    if (pipe(pipeEnds) != 0)
+    {
+        perror("Could not create pipe.");
+        exit(1);
+    }
+
+    pid_t child = fork();
+
+    if (child < 0)
+    {
+        perror("Could not fork.");
+        exit(1);
+    }
+
+    if (child == 0)
+    {
+        RunResult_t result;
+
+        close(pipeEnds[0]);
+
+        Simulator_t *sim = createSimulator(mode, memory_scheme, TIMEOUT_AMOUNT, AGING_INTERVAL);
+
+        if (sim == NULL)
+        {
+            fprintf(stderr, "unknown mode %d or memory scheme %d\n", mode, memory_scheme);
+            _exit(1);
+        }
+
+        double start = now_seconds();
+        bool loaded = loadSimulatorFile(sim, fileName);
+        result.load_seconds = now_seconds() - start;
+
+        start = now_seconds();
+        bool ran = loaded && runSimulator(sim, engine);
+        result.run_seconds = now_seconds() - start;
+
+        //the parent reports the failed run
+        if (!ran)
+        {
+            fprintf(stderr, "%s\n", getSimulatorError(sim));
+            _exit(1);
+        }
+
+        result.processes = getStateCount(sim, TERMINATED);
+        result.ticks = getSimulatorClock(sim);
+        result.transitions = getSimulatorMetrics(sim)->transitions;
+
+        destroySimulator(sim);
+
+        if (write(pipeEnds[1], &result, sizeof(result)) != (ssize_t)sizeof(result))
+        {
+            _exit(1);
+        }
+
+        _exit(0);
+    }
+
+    close(pipeEnds[1]);
+
+    RunResult_t result;
+    ssize_t received = read(pipeEnds[0], &result, sizeof(result));
+
+    close(pipeEnds[0]);
+
+    int status;
+    struct rusage usage;
+
+    if (wait4(child, &status, 0, &usage) != child || !WIFEXITED(status) || WEXITSTATUS(status) != 0 ||
+        received != (ssize_t)sizeof(result))
+    {
+        fprintf(stderr, "run of %s with mode %d and memory scheme %d failed\n", fileName, mode, memory_scheme);
+        exit(1);
+    }
+
+    //ru_maxrss is in kilobytes on Linux
+    *peak_rss_kb = usage.ru_maxrss;
+
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    long long sizes[MAX_VALUES] = {1000, 100000, 10000000};
+    int numberOfSizes = 3;
+    long long modes[MAX_VALUES] = {1, 2, 3};
+    int numberOfModes = 3;
+    long long schemes[MAX_VALUES] = {1, 2};
+    int numberOfSchemes = 2;
+    Engines engine = EVENT_ENGINE;
+    unsigned long long seed = 1;
+    const char *workloadDirectory = "bench_workloads";
+    const char *outputFileName = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--sizes=", 8) == 0)
+        {
+            numberOfSizes = parseList("--sizes", argv[i] + 8, sizes);
+        }
+        else if (strncmp(argv[i], "--modes=", 8) == 0)
+        {
+            numberOfModes = parseList("--modes", argv[i] + 8, modes);
+        }
+        else if (strncmp(argv[i], "--schemes=", 10) == 0)
+        {
+            numberOfSchemes = parseList("--schemes", argv[i] + 10, schemes);
+        }
+        else if (strcmp(argv[i], "--engine=event") == 0)
+        {
+            engine = EVENT_ENGINE;
+        }
+        else if (strcmp(argv[i], "--engine=tick") == 0)
+        {
+            engine = TICK_ENGINE;
+        }
+        else if (strncmp(argv[i], "--seed=", 7) == 0)
+        {
+            seed = strtoull(argv[i] + 7, NULL, 10);
+        }
+        else if (strncmp(argv[i], "--workload-dir=", 15) == 0)
+        {
+            workloadDirectory = argv[i] + 15;
+        }
+        else if (strncmp(argv[i], "--output=", 9) == 0)
+        {
+            outputFileName = argv[i] + 9;
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--sizes=N,..] [--modes=M,..] [--schemes=S,..] [--engine=event|tick] [--seed=N] "
+                            "[--workload-dir=DIR] [--output=FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (mkdir(workloadDirectory, 0777) != 0 && errno != EEXIST)
+    {
+        perror("Could not create the workload directory.");
+        return 1;
+    }
+
+    FILE *output = stdout;
+
+    if (outputFileName != NULL && (output = fopen(outputFileName, "w")) == NULL)
+    {
+        perror("Could not create file.");
+        return 1;
+    }
+
+    fprintf(output, "{\"engine\":\"%s\",\"seed\":%llu,\"runs\":[", engine == EVENT_ENGINE ? "event" : "tick", seed);
+
+    bool first = true;
+
+    for (int s = 0; s < numberOfSizes; s++)
+    {
+        char fileName[4096];
+
+        if (snprintf(fileName, sizeof(fileName), "%s/workload_%lld_seed%llu.txt", workloadDirectory, sizes[s], seed) >=
+            (int)sizeof(fileName))
+        {
+            fprintf(stderr, "workload directory name too long: %s\n", workloadDirectory);
+            exit(1);
+        }
+
+        double start = now_seconds();
+        prepareWorkload(fileName, sizes[s], seed);
+        fprintf(stderr, "workload of %lld processes ready in %.1f s\n", sizes[s], now_seconds() - start);
+
+        for (int m = 0; m < numberOfModes; m++)
+        {
+            for (int ms = 0; ms < numberOfSchemes; ms++)
+            {
+                long peak_rss_kb;
+                RunResult_t result = runChild(fileName, (int)modes[m], (int)schemes[ms], engine, &peak_rss_kb);
+
+                fprintf(stderr, "  mode %lld, memory scheme %lld: %.3f s\n", modes[m], schemes[ms], result.run_seconds);
+
+                fprintf(output, "%s\n  {\"processes\":%lld,\"mode\":%lld,\"memory_scheme\":%lld,\"load_seconds\":%.6f,"
+                                "\"run_seconds\":%.6f,\"ticks\":%lld,\"transitions\":%lld,\"ticks_per_second\":%.1f,"
+                                "\"transitions_per_second\":%.1f,\"peak_rss_kb\":%ld}",
+                        first ? "" : ",", result.processes, modes[m], schemes[ms], result.load_seconds,
+                        result.run_seconds, result.ticks, result.transitions,
+                        result.run_seconds > 0 ? result.ticks / result.run_seconds : 0.0,
+                        result.run_seconds > 0 ? result.transitions / result.run_seconds : 0.0, peak_rss_kb);
+                fflush(output);
+
+                first = false;
+            }
+        }
+    }
+
+    fprintf(output, "\n]}\n");
+
+    if (output != stdout)
+    {
+        fclose(output);
+    }
+
+    return 0;
+}
@@ -0,0 +1,488 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "fair_queue.h"
+
+//Weights of the priorities -20 to 19 (the Linux nice levels), a priority one level lower gets about 1.25 times the
+//weight so a process gets about 10% more CPU than one with the next priority.
+static const int FAIR_WEIGHTS[40] = {
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+    9548, 7620, 6100, 4904, 3906,
+    3121, 2501, 1991, 1586, 1277,
+    1024, 820, 655, 526, 423,
+    335, 272, 215, 172, 137,
+    110, 87, 70, 56, 45,
+    36, 29, 23, 18, 15,
+};
+
+//Function that returns the weight of a process.
+//Parameter:- process, a PCB.
+//Return:- the weight of its initial priority (priorities outside -20 to 19 get the weight of the closest one).
+int fairWeight(process_t *process)
+{
+    int priority = process->initial_priority;
+
+    if (priority < -20)
+    {
+        priority = -20;
+    }
+    else if (priority > 19)
+    {
+        priority = 19;
+    }
+
+    return FAIR_WEIGHTS[priority + 20];
+}
+
+//Initializing an empty fair queue.
+FairQueue_t *initFairQueue()
+{
+    //Allocating memory for the fair queue on the heap.
+    FairQueue_t *FairQueue = (FairQueue_t *)malloc(sizeof(FairQueue_t));
+
+    //Starting with room for a few processes, node 0 is the black NIL node every leaf points to.
+    FairQueue->capacity = 16;
+    FairQueue->nodes = (FairNode_t *)malloc(sizeof(FairNode_t) * FairQueue->capacity);
+    FairQueue->nodes[0] = (FairNode_t){.process = NULL, .left = 0, .right = 0, .parent = 0, .red = 0};
+    FairQueue->root = 0;
+    FairQueue->leftmost = 0;
+    FairQueue->size = 0;
+    FairQueue->next_order = 0;
+    FairQueue->total_weight = 0;
+    FairQueue->min_vruntime = 0;
+
+    //Chaining the unused nodes into the free list.
+    FairQueue->free = 0;
+
+    for (int i = FairQueue->capacity - 1; i > 0; i--)
+    {
+        FairQueue->nodes[i].right = FairQueue->free;
+        FairQueue->free = i;
+    }
+
+    return FairQueue;
+}
+
+//Method to clean up the fair queue (deallocates the array of nodes and the queue).
+//Processes still on the queue belong to the caller and are not freed.
+//Parameter:- FairQueue, a fair queue.
+//Return:- N/A.
+void cleanFairQueue(FairQueue_t *FairQueue)
+{
+    free(FairQueue->nodes);
+    free(FairQueue);
+}
+
+//Function that takes a node off the free list, doubling the array when every node is used.
+//Parameter:- FairQueue, a fair queue.
+//Return:- the index of the node.
+static int allocateNode(FairQueue_t *FairQueue)
+{
+    if (FairQueue->free == 0)
+    {
+        int capacity = FairQueue->capacity * 2;
+
+        FairQueue->nodes = (FairNode_t *)realloc(FairQueue->nodes, sizeof(FairNode_t) * capacity);
+
+        for (int i = capacity - 1; i >= FairQueue->capacity; i--)
+        {
+            FairQueue->nodes[i].right = FairQueue->free;
+            FairQueue->free = i;
+        }
+
+        FairQueue->capacity = capacity;
+    }
+
+    int node = FairQueue->free;
+
+    FairQueue->free = FairQueue->nodes[node].right;
+
+    return node;
+}
+
+//Function that checks if node a comes before node b.
+//Parameters:- a and b, two nodes.
+//Return:- true if a has the smaller vruntime, or the same vruntime and was enqueued first.
+static bool fairNodeBefore(const FairNode_t *a, const FairNode_t *b)
+{
+    if (a->vruntime != b->vruntime)
+    {
+        return a->vruntime < b->vruntime;
+    }
+
+    return a->order < b->order;
+}
+
+//Method that rotates a node down to the left, its right child takes its place.
+//Parameter:- FairQueue, a fair queue.
+//Parameter:- x, the index of the node.
+//Return:- N/A.
+static void rotateLeft(FairQueue_t *FairQueue, int x)
+{
+    FairNode_t *nodes = FairQueue->nodes;
+    int y = nodes[x].right;
+
+    nodes[x].right = nodes[y].left;
+
+    if (nodes[y].left != 0)
+    {
+        nodes[nodes[y].left].parent = x;
+    }
+
+    nodes[y].parent = nodes[x].parent;
+
+    if (nodes[x].parent == 0)
+    {
+        FairQueue->root = y;
+    }
+    else if (x == nodes[nodes[x].parent].left)
+    {
+        nodes[nodes[x].parent].left = y;
+    }
+    else
+    {
+        nodes[nodes[x].parent].right = y;
+    }
+
+    nodes[y].left = x;
+    nodes[x].parent = y;
+}
+
+//Method that rotates a node down to the right, its left child takes its place.
+//Parameter:- FairQueue, a fair queue.
+//Parameter:- x, the index of the node.
+//Return:- N/A.
+static void rotateRight(FairQueue_t *FairQueue, int x)
+{
+    FairNode_t *nodes = FairQueue->nodes;
+    int y = nodes[x].left;
+
+    nodes[x].left = nodes[y].right;
+
+    if (nodes[y].right != 0)
+    {
+        nodes[nodes[y].right].parent = x;
+    }
+
+    nodes[y].parent = nodes[x].parent;
+
+    if (nodes[x].parent == 0)
+    {
+        FairQueue->root = y;
+    }
+    else if (x == nodes[nodes[x].parent].right)
+    {
+        nodes[nodes[x].parent].right = y;
+    }
+    else
+    {
+        nodes[nodes[x].parent].left = y;
+    }
+
+    nodes[y].right = x;
+    nodes[x].parent = y;
+}
+
+//Method for enqueue-ing a process at its vruntime in O(log n).
+//Parameter:- FairQueue, a fair queue.
+//Parameter:- process, a PCB to enqueue, with its vruntime set.
+//Return:- N/A.
+void fair_enqueue(FairQueue_t *FairQueue, process_t *process)
+{
+    int z = allocateNode(FairQueue);
+    FairNode_t *nodes = FairQueue->nodes;
+
+    nodes[z] = (FairNode_t){.process = process, .vruntime = process->vruntime, .order = FairQueue->next_order++,
+                            .left = 0, .right = 0, .parent = 0, .red = 1};
+
+    //Walking down from the root to the leaf the new node goes on, it stays the leftmost if it never goes right.
+    int parent = 0;
+    bool leftmost = true;
+
+    for (int x = FairQueue->root; x != 0;)
+    {
+        parent = x;
+
+        if (fairNodeBefore(&nodes[z], &nodes[x]))
+        {
+            x = nodes[x].left;
+        }
+        else
+        {
+            x = nodes[x].right;
+            leftmost = false;
+        }
+    }
+
+    nodes[z].parent = parent;
+
+    if (parent == 0)
+    {
+        FairQueue->root = z;
+    }
+    else if (fairNodeBefore(&nodes[z], &nodes[parent]))
+    {
+        nodes[parent].left = z;
+    }
+    else
+    {
+        nodes[parent].right = z;
+    }
+
+    if (leftmost)
+    {
+        FairQueue->leftmost = z;
+    }
+
+    //Recoloring and rotating until no red node has a red parent.
+    while (nodes[nodes[z].parent].red)
+    {
+        int p = nodes[z].parent;
+        int g = nodes[p].parent;
+
+        if (p == nodes[g].left)
+        {
+            int uncle = nodes[g].right;
+
+            if (nodes[uncle].red)
+            {
+                nodes[p].red = 0;
+                nodes[uncle].red = 0;
+                nodes[g].red = 1;
+                z = g;
+            }
+            else
+            {
+                if (z == nodes[p].right)
+                {
+                    z = p;
+                    rotateLeft(FairQueue, z);
+                    p = nodes[z].parent;
+                    g = nodes[p].parent;
+                }
+
+                nodes[p].red = 0;
+                nodes[g].red = 1;
+                rotateRight(FairQueue, g);
+            }
+        }
+        else
+        {
+            int uncle = nodes[g].left;
+
+            if (nodes[uncle].red)
+            {
+                nodes[p].red = 0;
+                nodes[uncle].red = 0;
+                nodes[g].red = 1;
+                z = g;
+            }
+            else
+            {
+                if (z == nodes[p].left)
+                {
+                    z = p;
+                    rotateRight(FairQueue, z);
+                    p = nodes[z].parent;
+                    g = nodes[p].parent;
+                }
+
+                nodes[p].red = 0;
+                nodes[g].red = 1;
+                rotateLeft(FairQueue, g);
+            }
+        }
+    }
+
+    nodes[FairQueue->root].red = 0;
+
+    FairQueue->size++;
+    FairQueue->total_weight += fairWeight(process);
+}
+
+//Method that puts node v in the place of node u in the tree.
+//Parameter:- FairQueue, a fair queue.
+//Parameter:- u and v, the indexes of the nodes (v can be NIL).
+//Return:- N/A.
+static void transplant(FairQueue_t *FairQueue, int u, int v)
+{
+    FairNode_t *nodes = FairQueue->nodes;
+
+    if (nodes[u].parent == 0)
+    {
+        FairQueue->root = v;
+    }
+    else if (u == nodes[nodes[u].parent].left)
+    {
+        nodes[nodes[u].parent].left = v;
+    }
+    else
+    {
+        nodes[nodes[u].parent].right = v;
+    }
+
+    nodes[v].parent = nodes[u].parent;
+}
+
+//Function that dequeues the process with the smallest vruntime off the fair queue in O(log n).
+//The leftmost node has no left child, so it is replaced by its right child (if any), and the next leftmost node is
+//the leftmost node of that right child's subtree, or the parent.
+//Parameter:- FairQueue, a fair queue.
+//Return:- a process struct.
+process_t *fair_dequeue(FairQueue_t *FairQueue)
+{
+    //assertion: the simulator only dequeues a queue that is not empty, so dequeuing an empty one is a bug and exits
+    if (FairQueue->size == 0)
+    {
+        perror("Error nothing is in the queue, Returning an empty process");
+        exit(-1);
+    }
+
+    FairNode_t *nodes = FairQueue->nodes;
+    int z = FairQueue->leftmost;
+    process_t *frontProcess = nodes[z].process;
+
+    //Finding the next leftmost node before the tree changes.
+    int next = nodes[z].parent;
+
+    if (nodes[z].right != 0)
+    {
+        next = nodes[z].right;
+
+        while (nodes[next].left != 0)
+        {
+            next = nodes[next].left;
+        }
+    }
+
+    //The vruntime the scheduler measures new processes from never goes down.
+    if (nodes[z].vruntime > FairQueue->min_vruntime)
+    {
+        FairQueue->min_vruntime = nodes[z].vruntime;
+    }
+
+    //Removing the node, a black node leaves its subtree one black node short and is fixed up from its child x.
+    int x = nodes[z].right;
+    bool removedBlack = !nodes[z].red;
+
+    transplant(FairQueue, z, x);
+
+    while (removedBlack && x != FairQueue->root && !nodes[x].red)
+    {
+        int p = nodes[x].parent;
+
+        if (x == nodes[p].left)
+        {
+            int w = nodes[p].right;
+
+            if (nodes[w].red)
+            {
+                nodes[w].red = 0;
+                nodes[p].red = 1;
+                rotateLeft(FairQueue, p);
+                w = nodes[p].right;
+            }
+
+            if (!nodes[nodes[w].left].red && !nodes[nodes[w].right].red)
+            {
+                nodes[w].red = 1;
+                x = p;
+            }
+            else
+            {
+                if (!nodes[nodes[w].right].red)
+                {
+                    nodes[nodes[w].left].red = 0;
+                    nodes[w].red = 1;
+                    rotateRight(FairQueue, w);
+                    w = nodes[p].right;
+                }
+
+                nodes[w].red = nodes[p].red;
+                nodes[p].red = 0;
+                nodes[nodes[w].right].red = 0;
+                rotateLeft(FairQueue, p);
+                x = FairQueue->root;
+            }
+        }
+        else
+        {
+            int w = nodes[p].left;
+
+            if (nodes[w].red)
+            {
+                nodes[w].red = 0;
+                nodes[p].red = 1;
+                rotateRight(FairQueue, p);
+                w = nodes[p].left;
+            }
+
+            if (!nodes[nodes[w].right].red && !nodes[nodes[w].left].red)
+            {
+                nodes[w].red = 1;
+                x = p;
+            }
+            else
+            {
+                if (!nodes[nodes[w].left].red)
+                {
+                    nodes[nodes[w].right].red = 0;
+                    nodes[w].red = 1;
+                    rotateLeft(FairQueue, w);
+                    w = nodes[p].left;
+                }
+
+                nodes[w].red = nodes[p].red;
+                nodes[p].red = 0;
+                nodes[nodes[w].left].red = 0;
+                rotateRight(FairQueue, p);
+                x = FairQueue->root;
+            }
+        }
+    }
+
+    if (removedBlack)
+    {
+        nodes[x].red = 0;
+    }
+
+    //The NIL node's parent is only borrowed by the fix up.
+    nodes[0].parent = 0;
+    nodes[0].red = 0;
+
+    //Putting the node back on the free list.
+    nodes[z].right = FairQueue->free;
+    FairQueue->free = z;
+
+    FairQueue->leftmost = next;
+    FairQueue->size--;
+    FairQueue->total_weight -= fairWeight(frontProcess);
+
+    return frontProcess;
+}
+
+//function that returns the number of processes on the fair queue
+//parameters a pointer to a fair queue
+//returns the size of the fair queue inputted
+int getFairQueueSize(FairQueue_t *FairQueue)
+{
+    return FairQueue->size;
+}
+
+//function that returns the sum of the weights of the processes on the fair queue
+//parameters a pointer to a fair queue
+//returns the total weight
+long long getFairQueueWeight(FairQueue_t *FairQueue)
+{
+    return FairQueue->total_weight;
+}
+
+//function that returns the smallest vruntime dispatched so far, new and waking processes are placed relative to it
+//parameters a pointer to a fair queue
+//returns the smallest vruntime
+long long getMinVruntime(FairQueue_t *FairQueue)
+{
+    return FairQueue->min_vruntime;
+}
@@ -0,0 +1,62 @@
+#ifndef FAIR_QUEUE_H
+#define FAIR_QUEUE_H
+
+#include "process.h"
+
+/* ======================================================
+ * FAIR QUEUE IMPLEMENTATION
+ * ======================================================
+ */
+
+//Weight of a process with priority 0, a process with this weight gets FAIR_NICE_0_WEIGHT units of virtual runtime
+//per tick it runs for (a process with a heavier weight gets fewer, a lighter one more).
+#define FAIR_NICE_0_WEIGHT 1024
+
+//A node of the red-black tree, the nodes are kept in an array and linked by their index (0 is the NIL node).
+typedef struct FairNode
+{
+    process_t *process;       // Pointer to the node's PCB (named process).
+    long long vruntime;       // Virtual runtime of the process when it was enqueued, fixed while queued.
+    unsigned long long order; // Sequence number of the enqueue, keeps processes with the same vruntime first come first served.
+    int left;                 // Index of the left child.
+    int right;                // Index of the right child (of the next free node for a free node).
+    int parent;               // Index of the parent.
+    int red;                  // 1 for a red node, 0 for a black node.
+} FairNode_t;
+
+//Ready queue of the completely fair scheduler: a red-black tree of the ready processes ordered by virtual runtime,
+//then first come first served, with the leftmost node (the next process to run) cached.
+//Enqueue-ing is O(log n), dequeue-ing the leftmost node is O(log n) for the rebalancing, and finding it is O(1).
+//The nodes live in one array that only grows (doubling) when it is full, so the tree never allocates once it has
+//reached its largest size, and freed nodes are reused.
+typedef struct FairQueue
+{
+    FairNode_t *nodes;             // Array of the nodes, nodes[0] is the NIL node.
+    int root;                      // Index of the root, 0 if the tree is empty.
+    int leftmost;                  // Index of the node with the smallest vruntime, 0 if the tree is empty.
+    int free;                      // Index of the first free node, 0 if there is none.
+    int size;                      // Number of processes in the tree.
+    int capacity;                  // Number of nodes the array can hold before growing (NIL included).
+    unsigned long long next_order; // Sequence number given to the next enqueued process.
+    long long total_weight;        // Sum of the weights of the processes in the tree.
+    long long min_vruntime;        // Smallest vruntime dispatched so far, never goes down.
+} FairQueue_t;
+
+//Constructing and clean up functions for the fair queue.
+FairQueue_t *initFairQueue();
+void cleanFairQueue(FairQueue_t *FairQueue);
+
+//Commands for enqueue-ing a process at its vruntime and dequeue-ing the process with the smallest vruntime.
+void fair_enqueue(FairQueue_t *FairQueue, process_t *process);
+process_t *fair_dequeue(FairQueue_t *FairQueue);
+
+//Accessor methods for the size, the total weight and the smallest vruntime of the fair queue.
+int getFairQueueSize(FairQueue_t *FairQueue);
+long long getFairQueueWeight(FairQueue_t *FairQueue);
+long long getMinVruntime(FairQueue_t *FairQueue);
+
+//Function that returns the weight of a process from its initial priority (0 is nice 0, every level up or down
+//changes the CPU share by about 10%, like the Linux nice levels).
+int fairWeight(process_t *process);
+
+#endif //FAIR_QUEUE_H
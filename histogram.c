@@ -0,0 +1,103 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "histogram.h"
+
+//Function that returns the bucket of a value
+//values below HISTOGRAM_SUB_BUCKETS have their own bucket, larger values are shifted down until they are between
+//HISTOGRAM_HALF_BUCKETS and HISTOGRAM_SUB_BUCKETS, and the shift picks the group of buckets
+static int bucketOf(long long value)
+{
+    if (value < HISTOGRAM_SUB_BUCKETS)
+    {
+        return (int)value;
+    }
+
+    int shift = (63 - __builtin_clzll((unsigned long long)value)) - (HISTOGRAM_SUB_BITS - 1);
+
+    return shift * HISTOGRAM_HALF_BUCKETS + (int)(value >> shift);
+}
+
+//Function that returns the highest value that goes into a bucket
+static long long highestInBucket(int bucket)
+{
+    if (bucket < HISTOGRAM_SUB_BUCKETS)
+    {
+        return bucket;
+    }
+
+    int shift = bucket / HISTOGRAM_HALF_BUCKETS - 1;
+    long long sub = bucket - shift * HISTOGRAM_HALF_BUCKETS;
+
+    return ((sub + 1) << shift) - 1;
+}
+
+//Method that empties a histogram.
+//Parameter:- Histogram, a histogram.
+//Return:- N/A.
+void resetHistogram(Histogram_t *Histogram)
+{
+    memset(Histogram, 0, sizeof(Histogram_t));
+}
+
+//Method that records a value in a histogram.
+//Parameter:- Histogram, a histogram.
+//Parameter:- value, a number of ticks.
+//Return:- N/A.
+void recordValue(Histogram_t *Histogram, long long value)
+{
+    if (value < 0)
+    {
+        value = 0;
+    }
+
+    Histogram->counts[bucketOf(value)]++;
+    Histogram->count++;
+
+    if (value > Histogram->max)
+    {
+        Histogram->max = value;
+    }
+}
+
+//Function that returns a percentile of the recorded values.
+//Parameter:- Histogram, a histogram.
+//Parameter:- fraction, the fraction of the values (0.99 for p99).
+//Return:- the highest value of the bucket the percentile falls in (at most the largest value).
+long long getPercentile(Histogram_t *Histogram, double fraction)
+{
+    if (Histogram->count == 0)
+    {
+        return 0;
+    }
+
+    //number of values at or below the percentile, at least one
+    double exact = fraction * (double)Histogram->count;
+    long long rank = (long long)exact;
+
+    if ((double)rank < exact)
+    {
+        rank++;
+    }
+
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+
+    long long seen = 0;
+
+    for (int bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+    {
+        seen += Histogram->counts[bucket];
+
+        if (seen >= rank)
+        {
+            long long value = highestInBucket(bucket);
+
+            return value < Histogram->max ? value : Histogram->max;
+        }
+    }
+
+    return Histogram->max;
+}
@@ -0,0 +1,36 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+/* ======================================================
+ * LATENCY HISTOGRAM IMPLEMENTATION
+ * ======================================================
+ */
+
+//Values below 2^HISTOGRAM_SUB_BITS get a bucket each, larger values share buckets 2^(HISTOGRAM_SUB_BITS - 1)
+//to a power of two, so a bucket is never wider than 1/64 of the values in it (under 1.6% error).
+#define HISTOGRAM_SUB_BITS 7
+#define HISTOGRAM_SUB_BUCKETS (1 << HISTOGRAM_SUB_BITS)
+#define HISTOGRAM_HALF_BUCKETS (HISTOGRAM_SUB_BUCKETS / 2)
+
+//Buckets needed for every non-negative long long (the highest power of two is 2^62).
+#define HISTOGRAM_BUCKETS ((63 - HISTOGRAM_SUB_BITS + 2) * HISTOGRAM_HALF_BUCKETS)
+
+//Log-linear (HDR style) histogram of non-negative tick counts.
+//Recording a value is O(1) (one count is incremented), and the memory used is the same however many values
+//are recorded, so the tail of a distribution (p99, p99.9) is known without storing every value.
+typedef struct Histogram
+{
+    long long counts[HISTOGRAM_BUCKETS]; // Number of values in each bucket.
+    long long count;                     // Number of values recorded.
+    long long max;                       // Largest value recorded.
+} Histogram_t;
+
+//Commands for emptying a histogram and recording a value (negative values are recorded as 0).
+void resetHistogram(Histogram_t *Histogram);
+void recordValue(Histogram_t *Histogram, long long value);
+
+//Returns the value below or at which a fraction (0 to 1) of the recorded values are, to the precision of the
+//buckets (the highest value of the bucket, never more than the largest value), 0 if nothing was recorded.
+long long getPercentile(Histogram_t *Histogram, double fraction);
+
+#endif //HISTOGRAM_H
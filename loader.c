@@ -0,0 +1,604 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "loader.h"
+
+//Number of columns of the input file that are read, the memory needed and the relative deadline are the last ones
+//(only the columns up to the priority are required, and the memory needed when a memory scheme is used)
+#define INPUT_COLUMNS 8
+#define REQUIRED_COLUMNS 6
+
+//Size of the buffer a streamed input file is read into, it grows if a single line is longer
+#define STREAM_BUFFER_SIZE (64 * 1024)
+
+//The contents of an input file, mapped into memory (or read into a buffer where mmap is not available)
+typedef struct InputFile
+{
+    const char *data; // Bytes of the file.
+    size_t length;    // Number of bytes.
+    int mapped;       // 1 if data is a mapping, 0 if it is a malloc'd buffer.
+} InputFile_t;
+
+//Function that describes an error of the system (opening, reading or allocating) with the reason given by errno
+//parameters are the buffer the error is described in, what failed and the name of the file
+//returns false, for the loading functions to return
+static bool systemError(char *error, const char *what, const char *inputFile)
+{
+    snprintf(error, LOADER_ERROR_SIZE, "%s %s: %s", what, inputFile, strerror(errno));
+
+    return false;
+}
+
+//Function that opens an input file and maps it into memory
+//parameters are the name of the file, the contents to fill in and the buffer an error is described in
+//returns true if the file was opened, false (with the error described) if it could not be
+static bool openInputFile(const char *inputFile, InputFile_t *file, char *error)
+{
+    file->data = "";
+    file->length = 0;
+    file->mapped = 0;
+
+#ifdef _WIN32
+    //reading the whole file into a buffer
+    FILE *stream = fopen(inputFile, "rb");
+
+    if (stream == NULL)
+    {
+        return systemError(error, "Could not open file", inputFile);
+    }
+
+    fseek(stream, 0, SEEK_END);
+    file->length = (size_t)ftell(stream);
+    fseek(stream, 0, SEEK_SET);
+
+    char *buffer = (char *)malloc(file->length + 1);
+
+    if (buffer == NULL)
+    {
+        fclose(stream);
+        return systemError(error, "Could not read file", inputFile);
+    }
+
+    file->length = fread(buffer, 1, file->length, stream);
+    file->data = buffer;
+
+    fclose(stream);
+#else
+    int descriptor = open(inputFile, O_RDONLY);
+
+    //Checks for file if file opened properly
+    if (descriptor < 0)
+    {
+        return systemError(error, "Could not open file", inputFile);
+    }
+
+    struct stat status;
+
+    if (fstat(descriptor, &status) != 0)
+    {
+        close(descriptor);
+        return systemError(error, "Could not read file", inputFile);
+    }
+
+    file->length = (size_t)status.st_size;
+
+    //an empty file can not be mapped, it has no processes anyway
+    if (file->length > 0)
+    {
+        void *mapping = mmap(NULL, file->length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+        if (mapping == MAP_FAILED)
+        {
+            close(descriptor);
+            return systemError(error, "Could not map file", inputFile);
+        }
+
+        //the file is read once from start to end
+        madvise(mapping, file->length, MADV_SEQUENTIAL);
+
+        file->data = (const char *)mapping;
+        file->mapped = 1;
+    }
+
+    close(descriptor);
+#endif
+
+    return true;
+}
+
+//Method that unmaps (or frees) the contents of an input file
+//parameters are the contents of the file
+//returns nothing
+static void closeInputFile(InputFile_t file)
+{
+#ifdef _WIN32
+    free((char *)file.data);
+#else
+    if (file.mapped)
+    {
+        munmap((void *)file.data, file.length);
+    }
+#endif
+}
+
+//Function that describes a malformed line of the input file
+//parameters are the buffer the error is described in, the name of the file, the line number and a description of
+//the problem
+//returns NULL, for parseLine to return
+static const char *malformedLine(char *error, const char *inputFile, long line, const char *problem)
+{
+    snprintf(error, LOADER_ERROR_SIZE, "%s:%ld: malformed line: %s", inputFile, line, problem);
+
+    return NULL;
+}
+
+//Function that checks if a character separates the numbers on a line (anything but the end of the line)
+static int isSeparator(char character)
+{
+    return character == ' ' || character == '\t' || character == '\r' || character == '\v' || character == '\f';
+}
+
+//Function that parses one line of the input file into a process
+//parameters are the name of the file and the line number (for errors), the start and end of the bytes left,
+//the memory scheme, the process to fill in, a flag set to true if the line held a process and the buffer an error
+//is described in
+//returns a pointer past the end of the line (past its '\n'), NULL if the line is malformed
+static const char *parseLine(const char *inputFile, long line, const char *current, const char *end,
+                             int memory_scheme, process_t *process, bool *parsed, char *error)
+{
+    int values[INPUT_COLUMNS] = {0};
+    int columns = 0;
+
+    //columns a line must have, the memory needed is only required when a memory scheme is used
+    int required_columns = memory_scheme != 0 ? REQUIRED_COLUMNS + 1 : REQUIRED_COLUMNS;
+
+    //parses the numbers of the line straight from the bytes of the file
+    while (true)
+    {
+        while (current < end && isSeparator(*current))
+        {
+            current++;
+        }
+
+        if (current == end || *current == '\n')
+        {
+            break;
+        }
+
+        int negative = 0;
+
+        if (*current == '-' || *current == '+')
+        {
+            negative = *current == '-';
+            current++;
+        }
+
+        if (current == end || *current < '0' || *current > '9')
+        {
+            return malformedLine(error, inputFile, line, "expected a number");
+        }
+
+        long long value = 0;
+
+        while (current < end && *current >= '0' && *current <= '9')
+        {
+            value = value * 10 + (*current - '0');
+
+            if (value > (long long)INT_MAX + 1)
+            {
+                return malformedLine(error, inputFile, line, "number out of range");
+            }
+
+            current++;
+        }
+
+        if (current < end && *current != '\n' && !isSeparator(*current))
+        {
+            return malformedLine(error, inputFile, line, "expected a number");
+        }
+
+        //a deadline before the arrival can never be met
+        if (columns == 7 && negative && value != 0)
+        {
+            return malformedLine(error, inputFile, line, "negative relative deadline");
+        }
+
+        if (negative)
+        {
+            value = -value;
+        }
+
+        if (value > INT_MAX)
+        {
+            return malformedLine(error, inputFile, line, "number out of range");
+        }
+
+        //columns past the ones the simulator uses are tolerated and ignored
+        if (columns < INPUT_COLUMNS)
+        {
+            values[columns] = (int)value;
+        }
+
+        columns++;
+    }
+
+    //moves past the end of the line
+    if (current < end)
+    {
+        current++;
+    }
+
+    //blank lines are skipped
+    *parsed = columns != 0;
+
+    if (!*parsed)
+    {
+        return current;
+    }
+
+    if (columns < required_columns)
+    {
+        return malformedLine(error, inputFile, line, memory_scheme != 0 ? "expected 7 numbers (the memory needed is required with a memory scheme)" : "expected at least 6 numbers");
+    }
+
+    memset(process, 0, sizeof(process_t));
+
+    //sets the members of the process struct according to the input from the file
+    process->pid = values[0];
+    process->arrival_time = values[1];
+    process->total_CPU_time = values[2];
+    process->IO_frequency = values[3];
+    process->IO_duration = values[4];
+    process->initial_priority = values[5];
+    process->memory_needed = values[6];
+    process->relative_deadline = values[7];
+
+    //sets new processes to initially be in a NEW state
+    process->state = NEW;
+
+    //initializes variables used to track cpu time, time until IO, and current IO duration
+    process->current_CPU_time_needed = process->total_CPU_time;
+    process->current_time_until_IO_is_finished = process->IO_duration;
+    process->current_time_until_IO = process->IO_frequency;
+    process->effective_priority = process->initial_priority;
+    process->partition_used = -1;
+
+    return current;
+}
+
+//Function that allocates (or resizes) the array of processes of a loaded input file
+//parameters are the array (NULL for a new one), the number of processes it has to hold, the name of the file and
+//the buffer an error is described in
+//returns the array, NULL if the memory can not be allocated (the array passed in is then left as it was)
+static process_t *growProcesses(process_t *processes, size_t capacity, const char *inputFile, char *error)
+{
+    if (capacity > SIZE_MAX / sizeof(process_t))
+    {
+        snprintf(error, LOADER_ERROR_SIZE, "%s: too many processes to load", inputFile);
+        return NULL;
+    }
+
+    process_t *grown = (process_t *)realloc(processes, sizeof(process_t) * capacity);
+
+    if (grown == NULL)
+    {
+        systemError(error, "Could not allocate the processes of", inputFile);
+    }
+
+    return grown;
+}
+
+process_t *loadProcesses(const char *inputFile, int memory_scheme, int *numberOfProcesses, char *error)
+{
+    InputFile_t file;
+
+    if (!openInputFile(inputFile, &file, error))
+    {
+        return NULL;
+    }
+
+    const char *current = file.data;
+    const char *end = file.data + file.length;
+
+    //the array of processes starts with a guess from the file size (a line is rarely shorter than 32 bytes), grows
+    //by half when it is full and is shrunk to the number of processes at the end
+    size_t capacity = file.length / 32 + 16;
+
+    if (capacity > INT_MAX)
+    {
+        capacity = INT_MAX;
+    }
+
+    int count = 0;
+    process_t *processes = growProcesses(NULL, capacity, inputFile, error);
+
+    long line = 0;
+
+    //while loop that goes through the file line by line until the end is reached
+    while (processes != NULL && current < end)
+    {
+        //growing the array when it is full, the number of processes has to fit in an int
+        if ((size_t)count == capacity)
+        {
+            process_t *grown = NULL;
+
+            if (capacity == INT_MAX)
+            {
+                malformedLine(error, inputFile, line + 1, "too many processes");
+            }
+            else
+            {
+                capacity = capacity > INT_MAX - capacity / 2 ? INT_MAX : capacity + capacity / 2;
+                grown = growProcesses(processes, capacity, inputFile, error);
+            }
+
+            if (grown == NULL)
+            {
+                free(processes);
+                processes = NULL;
+                break;
+            }
+
+            processes = grown;
+        }
+
+        bool parsed;
+
+        current = parseLine(inputFile, ++line, current, end, memory_scheme, &processes[count], &parsed, error);
+
+        //a malformed line stops the loading
+        if (current == NULL)
+        {
+            free(processes);
+            processes = NULL;
+            break;
+        }
+
+        if (parsed)
+        {
+            processes[count].load_order = count;
+            count++;
+        }
+    }
+
+    closeInputFile(file);
+
+    if (processes == NULL)
+    {
+        return NULL;
+    }
+
+    //gives back the slots the guess reserved and no process used (keeps them if the array can not be shrunk)
+    if ((size_t)count < capacity)
+    {
+        process_t *shrunk = (process_t *)realloc(processes, sizeof(process_t) * (count > 0 ? count : 1));
+
+        if (shrunk != NULL)
+        {
+            processes = shrunk;
+        }
+    }
+
+    *numberOfProcesses = count;
+
+    return processes;
+}
+
+int *sortByArrival(const process_t *processes, int numberOfProcesses)
+{
+    int *order = (int *)malloc(sizeof(int) * (numberOfProcesses > 0 ? numberOfProcesses : 1));
+    int *buffer = (int *)malloc(sizeof(int) * (numberOfProcesses > 0 ? numberOfProcesses : 1));
+    unsigned int *keys = (unsigned int *)malloc(sizeof(unsigned int) * (numberOfProcesses > 0 ? numberOfProcesses : 1));
+
+    //processes arriving before the first tick all arrive on tick 0
+    //the keys are stored by position so a pass only reads them, and every bit set in any key is collected so
+    //passes over digits that are the same for every process can be skipped
+    unsigned int used_bits = 0;
+
+    for (int i = 0; i < numberOfProcesses; i++)
+    {
+        keys[i] = processes[i].arrival_time > 0 ? (unsigned int)processes[i].arrival_time : 0;
+        used_bits |= keys[i];
+        order[i] = i;
+    }
+
+    //least significant digit first radix sort, one counting sort per byte of the arrival time
+    //every pass is stable, so processes arriving on the same tick stay in load order
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        if (((used_bits >> shift) & 0xFF) == 0)
+        {
+            continue;
+        }
+
+        int counts[257] = {0};
+
+        for (int i = 0; i < numberOfProcesses; i++)
+        {
+            counts[((keys[order[i]] >> shift) & 0xFF) + 1]++;
+        }
+
+        //turns the counts into the position each digit starts at
+        for (int digit = 0; digit < 256; digit++)
+        {
+            counts[digit + 1] += counts[digit];
+        }
+
+        for (int i = 0; i < numberOfProcesses; i++)
+        {
+            buffer[counts[(keys[order[i]] >> shift) & 0xFF]++] = order[i];
+        }
+
+        int *sorted = buffer;
+        buffer = order;
+        order = sorted;
+    }
+
+    free(buffer);
+    free(keys);
+
+    return order;
+}
+
+//Method that reads the next process of a stream into its lookahead, refilling the buffer from the file
+//one chunk at a time so only the bytes of the lines being parsed are in memory
+//a malformed line or a read error fails the stream, it then has no next process
+//parameters are the stream
+//returns nothing
+static void readAhead(ProcessStream_t *stream)
+{
+    stream->has_next = false;
+
+    while (!stream->has_next && !stream->failed)
+    {
+        char *line_end = (char *)memchr(stream->buffer + stream->start, '\n', stream->end - stream->start);
+
+        //the buffer does not hold a whole line, moves the partial line to the front and reads more of the file
+        if (line_end == NULL && !stream->at_end)
+        {
+            memmove(stream->buffer, stream->buffer + stream->start, stream->end - stream->start);
+            stream->end -= stream->start;
+            stream->start = 0;
+
+            //doubling the buffer when a single line does not fit in it
+            if (stream->end == stream->capacity)
+            {
+                char *grown = (char *)realloc(stream->buffer, stream->capacity * 2);
+
+                if (grown == NULL)
+                {
+                    stream->failed = !systemError(stream->error, "Could not read a line of", stream->name);
+                    return;
+                }
+
+                stream->capacity *= 2;
+                stream->buffer = grown;
+            }
+
+            size_t bytes = fread(stream->buffer + stream->end, 1, stream->capacity - stream->end, stream->file);
+
+            if (bytes == 0)
+            {
+                if (ferror(stream->file))
+                {
+                    stream->failed = !systemError(stream->error, "Could not read file", stream->name);
+                    return;
+                }
+
+                stream->at_end = true;
+            }
+
+            stream->end += bytes;
+
+            continue;
+        }
+
+        //nothing left to parse
+        if (stream->start == stream->end)
+        {
+            return;
+        }
+
+        const char *from = stream->buffer + stream->start;
+        const char *to = line_end != NULL ? line_end + 1 : stream->buffer + stream->end;
+        bool parsed;
+
+        if (parseLine(stream->name, ++stream->line, from, to, stream->memory_scheme, &stream->next, &parsed, stream->error) == NULL)
+        {
+            stream->failed = true;
+            return;
+        }
+
+        stream->start = to - stream->buffer;
+
+        if (parsed)
+        {
+            //the processes have to come in order of arrival so every process is read before its arrival tick
+            if (stream->loaded > 0 && stream->next.arrival_time < stream->last_arrival)
+            {
+                malformedLine(stream->error, stream->name, stream->line, "arrival time goes back in time (streamed input has to be sorted by arrival time)");
+                stream->failed = true;
+                return;
+            }
+
+            stream->next.load_order = stream->loaded++;
+            stream->last_arrival = stream->next.arrival_time;
+            stream->has_next = true;
+        }
+    }
+}
+
+ProcessStream_t *openProcessStream(const char *inputFile, int memory_scheme, char *error)
+{
+    ProcessStream_t *stream = (ProcessStream_t *)malloc(sizeof(ProcessStream_t));
+
+    stream->file = fopen(inputFile, "rb");
+
+    //Checks for file if file opened properly
+    if (stream->file == NULL)
+    {
+        systemError(error, "Could not open file", inputFile);
+        free(stream);
+
+        return NULL;
+    }
+
+    stream->name = inputFile;
+    stream->memory_scheme = memory_scheme;
+    stream->capacity = STREAM_BUFFER_SIZE;
+    stream->buffer = (char *)malloc(stream->capacity);
+    stream->start = 0;
+    stream->end = 0;
+    stream->at_end = false;
+    stream->line = 0;
+    stream->loaded = 0;
+    stream->last_arrival = 0;
+    stream->failed = false;
+
+    //reads the first process, a stream that fails on it is not opened
+    readAhead(stream);
+
+    if (stream->failed)
+    {
+        snprintf(error, LOADER_ERROR_SIZE, "%s", stream->error);
+        closeProcessStream(stream);
+
+        return NULL;
+    }
+
+    return stream;
+}
+
+const process_t *peekProcess(ProcessStream_t *stream)
+{
+    return stream->has_next ? &stream->next : NULL;
+}
+
+void nextProcess(ProcessStream_t *stream, process_t *process)
+{
+    *process = stream->next;
+
+    readAhead(stream);
+}
+
+void closeProcessStream(ProcessStream_t *stream)
+{
+    fclose(stream->file);
+    free(stream->buffer);
+    free(stream);
+}
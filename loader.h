@@ -0,0 +1,69 @@
+#ifndef LOADER_H
+#define LOADER_H
+
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "process.h"
+
+/* ======================================================
+ * INPUT FILE LOADER
+ * ======================================================
+ */
+
+//Size of the buffer the loading functions describe an error in.
+#define LOADER_ERROR_SIZE 512
+
+//Loads every process of an input file in a single pass over the memory-mapped file.
+//Each non-blank line holds pid, arrival time, total CPU time, I/O frequency, I/O duration and priority,
+//followed by the memory needed when a memory scheme is used, and optionally by a deadline relative to the arrival
+//time (0 for none, the memory needed has to be given, as 0 without a memory scheme); extra columns are ignored.
+//Blank lines and trailing whitespace are skipped.
+//Returns the array of processes (freed by the caller) and sets numberOfProcesses to its size, or returns NULL and
+//describes the error in error (LOADER_ERROR_SIZE bytes) if the file can not be read or a line is malformed (with its
+//line number).
+process_t *loadProcesses(const char *inputFile, int memory_scheme, int *numberOfProcesses, char *error);
+
+//Sorts the loaded processes by arrival time with a radix sort, processes arriving on the same tick stay in load order.
+//Processes arriving before tick 0 are sorted as arriving on tick 0.
+//Returns the positions of the processes in the order they arrive (freed by the caller).
+int *sortByArrival(const process_t *processes, int numberOfProcesses);
+
+//An input file read one process at a time, for workloads too large to load at once.
+//Only a fixed size buffer of the file and the next process (the lookahead) are kept in memory.
+//The processes have to be sorted by arrival time, a process arriving before the one read before it is an error.
+typedef struct ProcessStream
+{
+    FILE *file;          // Input file being read.
+    const char *name;    // Name of the input file (for errors).
+    int memory_scheme;   // Memory scheme in use, the memory needed is required if it is not 0.
+    char *buffer;        // Bytes read from the file and not parsed yet are between start and end.
+    size_t capacity;     // Size of the buffer.
+    size_t start;        // Position of the first byte not parsed yet.
+    size_t end;          // Position after the last byte read.
+    bool at_end;         // The whole file has been read into the buffer.
+    long line;           // Line number of the last parsed line.
+    long long loaded;    // Number of processes read so far, the next one gets it as its load_order.
+    int last_arrival;    // Arrival time of the last process read.
+    process_t next;      // Next process of the stream.
+    bool has_next;       // false once every process has been read (or the stream failed).
+    bool failed;         // true once a line could not be read or was malformed.
+    char error[LOADER_ERROR_SIZE]; // Description of the failure.
+} ProcessStream_t;
+
+//Opens a stream over an input file and reads its first process.
+//Returns NULL and describes the error in error (LOADER_ERROR_SIZE bytes) if the file can not be opened or its first
+//process can not be read.
+ProcessStream_t *openProcessStream(const char *inputFile, int memory_scheme, char *error);
+
+//Returns the next process of the stream without taking it, NULL when every process has been taken or the stream
+//failed reading it (failed is then set and error says why).
+const process_t *peekProcess(ProcessStream_t *stream);
+
+//Copies the next process of the stream into process and reads the one after it.
+void nextProcess(ProcessStream_t *stream, process_t *process);
+
+//Closes the file and frees the stream.
+void closeProcessStream(ProcessStream_t *stream);
+
+#endif //LOADER_H
@@ -3,1184 +3,888 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdbool.h>
-
-//The different possible states a process can have ("TERMINATED" is synonymous for EXIT)
-typedef enum Process_State
-{
-    NEW,       // Process is NEW
-    READY,     // Process is READY to run
-    RUNNING,   // Process is RUNNING
-    WAITING,   // Process is WAITING for I/O and such
-    TERMINATED // Process is finished its task and TERMINATED/EXIT
-} States;
-
-//The data structure for the PCB
-typedef struct process
-{
-    int pid;                               // Process ID.
-    int arrival_time;                      // Time of arrival.
-    int total_CPU_time;                    // Total execution time.
-    int current_CPU_time_needed;           // Amount of CPU time needed to finish the task.
-    int IO_frequency;                      // How frequently IO is accessed.
-    int current_time_until_IO;             // Amount of time until I/O is needed by the process.
-    int IO_duration;                       // How long IO is accessed.
-    int current_time_until_IO_is_finished; // Amount of time until I/O is needed by the process.
-    int initial_priority;                  // Priority when the process first came into the queue.
-    int effective_priority;                // Effective priority the process currently has.
-    int memory_needed;                     // The amount of memory need for the process.
-    int partition_used;                    // The partition that the process is stored on, set to -1 is not in memory
-    States state;                          // Current state of a process.
-} process_t;
-
-/* ======================================================
- * QUEUE IMPLEMENTATION
- * ======================================================
- */
-
-//A Node for the queue.
-typedef struct Node
-{
-    struct Node *Next;  // Pointer to next Node.
-    process_t *process; // Pointer to the Node's PCB (named process).
-
-} Node_t;
-
-//Queue implementation with a LinkedList.
-typedef struct Queue
-{
-    Node_t *Head; // Pointer to head Node.
-    Node_t *Tail; // Pointer to tail Node.
-    int size;     // Size of the queue.
-} Queue_t;
-
-//Constructing function for queue.
-Queue_t *initReadyQueue();
-
-//Clean up function for queue.
-void cleanReadyQueue(Queue_t *ReadyQueue);
-
-//Commands for enqueue-ing, dequeue-ing, and accessor method for queue size.
-void enqueue(Queue_t *ReadyQueue, process_t *process);
-process_t *dequeue(Queue_t *ReadyQueue);
-int getQueueSize(Queue_t *ReadyQueue);
-
-//Commands for enqueue-ing with priority scheduler algorithm.
-//To prevent starvation aging has been recognised.
-void priority_enqueue(Queue_t *ReadyQueue, process_t *process);
-void age_priority_queue(Queue_t *ReadyQueue);
-
-
-//Initializing the queue and setting its member's initial state.
-Queue_t *initReadyQueue()
+#include <limits.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+
+#include "loader.h"
+#include "queue.h"
+#include "simulator.h"
+
+//runs every scenario of a parameter sweep (set up by the --sweep options) on a pool of worker threads
+int runSweep(int argc, char *argv[]);
+
+//reads a comma separated list of numbers given to an option, exits with the usage if one is not a number from minimum
+//to maximum
+int parseNumberList(const char *option, const char *text, int *values, int maxValues, int minimum, int maximum);
+
+//Method that prints how the simulator is run
+//parameters are: none
+//returns nothing
+static void printUsage()
 {
-
-    //Allocating memory for queue on the heap.
-    Queue_t *ReadyQueue = (Queue_t *)malloc(sizeof(Queue_t));
-
-    //Setting head and tail to NULL and size to 0.
-    ReadyQueue->Head = NULL;
-    ReadyQueue->Tail = NULL;
-    ReadyQueue->size = 0;
-
-    //Returning the queue.
-    return ReadyQueue;
+    fprintf(stderr, "usage: untitled [options] [mode [memory_scheme [input_file [output_file]]]]\n"
+                    "       untitled --sweep [--modes=1,2,3] [--schemes=0,1,2] [options] input_file...\n"
+                    "mode is 1 to %d, memory_scheme is 0 (none) to %d (see README.md for the options)\n",
+            LAST_MODE, LAST_MEMORY_SCHEME);
 }
 
-//Function ages all processes in the priority queue.
-//Method to print out the queue as it stands.
-//Parameter:- ReadyQueue, a queue.
-//Return:- N/A.
-void print_queue(Queue_t *ReadyQueue){
+//Function that reads a number given as a positional argument, exits with the usage if it is not a number from
+//minimum to maximum
+//parameters are: the name of the argument (for errors), the argument, the smallest and the largest number allowed
+//returns the number
+static int parseArgument(const char *name, const char *text, int minimum, int maximum)
+{
+    char *end;
 
-    //starts at head of queue
-    Node_t* current_node = ReadyQueue->Head;
+    errno = 0;
+    long value = strtol(text, &end, 10);
 
-    //iterates through queue and prints all elements with arrows pointing towards the tail
-    while (current_node != NULL)
+    if (end == text || *end != '\0' || errno != 0 || value < minimum || value > maximum)
     {
-        printf("%d (priority: %d) -> ", current_node->process->pid, current_node->process->effective_priority);
-
-        current_node = current_node->Next;
+        fprintf(stderr, "%s has to be a number from %d to %d, got %s\n", name, minimum, maximum, text);
+        printUsage();
+        exit(-1);
     }
 
-    printf("\n");
+    return (int)value;
 }
 
-//Method to clean up the queue (deallocates the memory on the heap of the queue).
-//Parameter:- ReadyQueue, a queue.
-//Return:- N/A.
-void cleanReadyQueue(Queue_t *ReadyQueue)
-{
-    free(ReadyQueue); //Freeing the provided queue.
-}
-
-//Method for enqueue-ing a process onto the queue.
-//Parameter:- ReadyQueue, a queue.
-//Parameter:- process, a PCB to enqueue.
-//Return:- N/A.
-void enqueue(Queue_t *ReadyQueue, process_t *process)
+//Method that exits if the simulation failed, after printing why
+//parameters are: the simulation
+//returns nothing
+static void exitIfFailed(Simulator_t *sim)
 {
+    const char *error = getSimulatorError(sim);
 
-    //If queue is empty; make first Node the head and the tail.
-    if (ReadyQueue->Tail == NULL)
-    {
-        //Allocating memory for a Node.
-        Node_t *node = (Node_t *)malloc(sizeof(Node_t));
-
-        //Creating a Node and setting its PCB to the process parameter.
-        node->process = process;
-
-        //Setting the next to NULL.
-        node->Next = NULL;
-
-        //Setting the head and the tail to the current Node.
-        ReadyQueue->Head = (Node_t *)node;
-        ReadyQueue->Tail = (Node_t *)node;
-    }
-
-    //If queue is not empty; make Node the tail.
-    else
+    if (error != NULL)
     {
-        //Allocating memory for a Node.
-        Node_t *node = (Node_t *)malloc(sizeof(Node_t));
-
-        //Creating a Node and setting its PCB to the process parameter.
-        node->process = process;
+        fprintf(stderr, "ERROR: %s\n", error);
 
-        //Setting next to NULL.
-        node->Next = NULL;
-
-        //Updating the old tail Node to point to the current Node.
-        ReadyQueue->Tail->Next = (Node_t *)node;
-
-        //Setting the tail to current Node (current Node becomes the new tail).
-        ReadyQueue->Tail = node;
+        //the output written so far is flushed to the output file
+        destroySimulator(sim);
+        exit(-1);
     }
-
-    //Incrementing the size of the queue.
-    ReadyQueue->size++;
-
-    //TESTING
-    //print_queue(ReadyQueue);
 }
 
-//Method for enqueue-ing a process onto the queue and placing it in the proper place according to priority.
-//Parameters:- ReadyQueue, a queue.
-//Parameter:- process, a PCB to enqueue.
-//Return:- N/A.
-// TODO: implement the priority enqueue
-void priority_enqueue(Queue_t *ReadyQueue, process_t *process)
+// Main function that runs the kernel simulator
+// Parameters are: the amount of commandline arguements , and an array of strings representing the arguments
+int main(int argc, char *argv[])
 {
-    //If the queue is empty; create a new one.
-    //The first Node becomes the head and the tail.
-    if (ReadyQueue->Tail == NULL)
+    //a sweep runs many simulations and reads the command line its own way
+    for (int i = 1; i < argc; i++)
     {
-        //Allocating memory for a Node.
-        Node_t *node = (Node_t *)malloc(sizeof(Node_t));
-
-        //Creating a Node and setting its PCB to the process parameter.
-        node->process = process;
-
-        //Setting next to NULL.
-        node->Next = NULL;
-
-        //Setting the head and the tail to the current Node.
-        ReadyQueue->Head = (Node_t *)node;
-        ReadyQueue->Tail = (Node_t *)node;
-
-        //Incrementing the size of the queue.
-        ReadyQueue->size++;
+        if (strcmp(argv[i], "--sweep") == 0)
+        {
+            return runSweep(argc, argv);
+        }
     }
 
-    //If the queue is not empty; compare priorities and add where needed.
-    else
-    {
-        //Allocating memory for a Node.
-        Node_t *node = (Node_t *) malloc(sizeof(Node_t));
-
-        //Creating a Node and setting its PCB to the process parameter.
-        node->process = process;
-
-        //Pointer to track the current Node.
-        Node_t* current_node = ReadyQueue->Head;
-
-        //Pointer to track the previous Node.
-        Node_t* prev_node = ReadyQueue->Head;
+    //variables for the inputfile and outputfile names (pointing at the command line arguments, so any length works)
+    const char *inputFileName = "input.txt";
+    const char *outputFileName = "output.txt";
 
-        //Iterating through the processes in the priority queue comparing priorities until
-        //a process with a higher priority (i.e., a lower number) than the process being enqueued is found.
-        while(current_node->process->effective_priority <= node->process->effective_priority){
+    //variable for checking which scheduling algorithm is being used
+    // 1 for FCFS, 2 for Priority Scheduling, 3 for Round Robin with 100ms timeout, 4 for the MLFQ, 5 for CFS,
+    // 6 for SJF, 7 for SRTF, 8 for preemptive Priority Scheduling, 9 for EDF
+    int mode;
 
-            //If the iteration reaches the head of the queue; stop iterating.
-            if(current_node == ReadyQueue->Tail){
-                break;
-            }
+    //variable for which memory_scheme to use
+    //set to 0 if unused
+    int memory_scheme = 0;
 
-            //Updating the previous Node and the current Node to the next Nodes in the LinkedList.
-            prev_node = current_node;
-            current_node = current_node->Next;
+    //variable for which engine runs the simulation, both produce the same output
+    //set with --engine=tick (default) or --engine=event
+    Engines engine = TICK_ENGINE;
+
+    //variable for reading the input file one process at a time just before each arrival instead of all at once
+    //set with --stream, the input file has to be sorted by arrival time
+    bool stream = false;
+
+    //variable for the format of the output file
+    //set with --trace=text (default), --trace=binary (records converted back to text by trace2text) or --trace=none
+    TraceFormats trace = TRACE_TEXT;
+
+    //variables for printing the scheduling metrics of the run to standard output once it is done
+    //set with --summary or --summary=text, and --summary=json for one line of JSON
+    bool summary = false;
+    bool summaryJson = false;
+
+    //variable for the accounting file every process gets a row in when it terminates
+    //set with --accounting=FILE, NULL if no accounting file is written
+    const char *accountingFileName = NULL;
+
+    //variable for printing the counts and times of the phases of the main loop to standard error once the run is done
+    //set with --stats, only available when built with cmake -DSCHEDULER_STATS=ON
+    bool stats = false;
+
+    //variables for the Round Robin quantum and the ticks between agings of the priority queue
+    //set with --quantum=N and --aging-interval=N
+    int quantum = TIMEOUT_AMOUNT;
+    int aging_interval = AGING_INTERVAL;
+
+    //variables for the levels of the MLFQ, the quantum of every level and the ticks between boosts
+    //set with --levels=N (by default MLFQ_LEVELS, or one level per quantum given), --level-quanta=Q0,Q1,.. (the levels
+    //after the last one given double its quantum, by default the top level's quantum is the Round Robin quantum)
+    //and --boost-interval=N
+    int levels = 0;
+    int levelQuanta[MLFQ_MAX_LEVELS];
+    int numberOfLevelQuanta = 0;
+    int boost_interval = MLFQ_BOOST_INTERVAL;
+
+    //variables for the time slices of CFS, set with --target-latency=N and --min-granularity=N
+    int target_latency = CFS_TARGET_LATENCY;
+    int min_granularity = CFS_MIN_GRANULARITY;
+
+    //options (arguments starting with "--") can be given anywhere, the remaining arguments are
+    //collected in order and read positionally below
+    char *arguments[5];
+    int argumentCount = 1;
+
+    arguments[0] = argv[0];
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--engine=tick") == 0)
+        {
+            engine = TICK_ENGINE;
         }
-
-        //If there is only one process on the queue; check for higher priority and add where neccessary.
-        if(ReadyQueue->Head == ReadyQueue->Tail){
-
-
-            //If the priority of the new Node is lesser than the present Node; add the new Node to the tail of the LinkedList.
-            if(ReadyQueue->Head->process->effective_priority <= node->process->effective_priority){
-
-                //Make head Node next point to new Node.
-                ReadyQueue->Head->Next = node;
-
-                //Make new Node next point to NULL as it is the new tail.
-                node->Next = NULL;
-
-                //Updating the ready queue's tail.
-                ReadyQueue->Tail = node;
-            }
-
-            //If the priority of the new Node is greater than the present Node; add the new Node to the head of the LinkedList.
-            else{
-
-                //Make new Node point to the old head Node.
-                node->Next = ReadyQueue->Head;
-                
-                //Updating the ready queue's head.
-                ReadyQueue->Head = node;
-            }
+        else if (strcmp(argv[i], "--engine=event") == 0)
+        {
+            engine = EVENT_ENGINE;
         }
-
-        //If the process being enqueued has a higher priority than the head; make it the new head.
-        else if(current_node == ReadyQueue->Head){
-
-            //printf("Current node is the head \n");
-            
-            //Setting new Node's next to the previous head Node, it is the new head.
-            node->Next = ReadyQueue->Head;
-
-            //Setting the head of the queue to be the new Node.
-            ReadyQueue->Head = node;
-
-
-        // if current node is the tail, we must make more comparisons
-        }else if(current_node == ReadyQueue->Tail){
-            //printf("Current node is the tail \n");
-
-
-            //If the process being enqueued has a lower priority than the tail; make it the new tail.
-            if(ReadyQueue->Tail->process->effective_priority <= node->process->effective_priority){
-
-                ReadyQueue->Tail->Next = node;
-
-                //Setting the new Node's next to the tail as it will be the new tail.
-                node->Next = NULL;
-
-                //Setting the tail of the queue to be the new Node.
-                ReadyQueue->Tail = (Node_t *) node;
-
-            //if the process being enqueued has a higher priority than the tail; place it before the tail.
-            }else{
-
-                node->Next = prev_node->Next;
-
-                prev_node->Next = node;
+        else if (strcmp(argv[i], "--stream") == 0)
+        {
+            stream = true;
+        }
+        else if (strcmp(argv[i], "--trace=text") == 0)
+        {
+            trace = TRACE_TEXT;
+        }
+        else if (strcmp(argv[i], "--trace=binary") == 0)
+        {
+            trace = TRACE_BINARY;
+        }
+        else if (strcmp(argv[i], "--trace=none") == 0)
+        {
+            trace = TRACE_NONE;
+        }
+        else if (strcmp(argv[i], "--summary") == 0 || strcmp(argv[i], "--summary=text") == 0)
+        {
+            summary = true;
+            summaryJson = false;
+        }
+        else if (strcmp(argv[i], "--summary=json") == 0)
+        {
+            summary = true;
+            summaryJson = true;
+        }
+        else if (strncmp(argv[i], "--accounting=", 13) == 0)
+        {
+            accountingFileName = argv[i] + 13;
+        }
+        else if (strcmp(argv[i], "--stats") == 0)
+        {
+            if (!simulatorHasStats())
+            {
+                fprintf(stderr, "--stats needs the instrumentation, configure with cmake -DSCHEDULER_STATS=ON\n");
+                exit(-1);
             }
 
-        //If the Node has a medium-level priority; it will be inserted in the middle (after processes with higher or
-        // the same priority but before processes with lower priority).
-        }else{
-
-            node->Next = prev_node->Next;
-
-            prev_node->Next = node;
-
+            stats = true;
         }
+        else if (strncmp(argv[i], "--quantum=", 10) == 0)
+        {
+            parseNumberList("--quantum", argv[i] + 10, &quantum, 1, 1, INT_MAX);
+        }
+        else if (strncmp(argv[i], "--aging-interval=", 17) == 0)
+        {
+            parseNumberList("--aging-interval", argv[i] + 17, &aging_interval, 1, 1, INT_MAX);
+        }
+        else if (strncmp(argv[i], "--levels=", 9) == 0)
+        {
+            parseNumberList("--levels", argv[i] + 9, &levels, 1, 1, INT_MAX);
 
-        //Incrementing the size of the queue.
-        ReadyQueue->size++;
-    }
-     
-}
-
-//function ages all processes in the priority queue
-//parameters are: a queue
-//returns nothing
-void age_priority_queue(Queue_t *ReadyQueue)
-{
-
-    // if the queue is empty, there is nothing to age
-    if (ReadyQueue->Tail == NULL)
-    {
-        return;
-    }
-    // queue is not empty
-    else
-    {
-     
-        // variable current_node
-        Node_t* current_node = ReadyQueue->Head;
-
-        //iterate throughout the entire priority queue and decrement the effective priority to age the processes
-        while(current_node != NULL){
-
-            //check if the effective priority is greater than 0 then decrement (to avoid negative numbers for priority)
-            if (current_node->process->effective_priority > 0)
+            if (levels > MLFQ_MAX_LEVELS)
             {
-                current_node->process->effective_priority--;
+                fprintf(stderr, "--levels can be at most %d\n", MLFQ_MAX_LEVELS);
+                exit(-1);
             }
-
-            current_node = current_node->Next;
         }
-
-    }
-}
-
-
-//function dequeues a process off the queue
-//parameters are: a queue
-//returns a process struct
-process_t *dequeue(Queue_t *ReadyQueue)
-{
-
-    //exits program if dequeue is attempted on an empty queue
-    if (ReadyQueue->Head == NULL || ReadyQueue->size == 0)
-    {
-        perror("Error nothing is in the queue, Returning an empty process");
-        exit(-1);
-
-        
-    }
-    //dequeues a process off the queue
-    else
-    {
-
-        //gets the process of the head node of the queue
-        process_t *frontProcess = ReadyQueue->Head->process;
-
-        // gets a reference to the head node
-        Node_t *ptr = ReadyQueue->Head;
-
-        // checks if enqueue has more than 1 node
-        if (ReadyQueue->Head != ReadyQueue->Tail)
+        else if (strncmp(argv[i], "--level-quanta=", 15) == 0)
         {
-
-            //updates head node to point to the next node
-            ReadyQueue->Head = ReadyQueue->Head->Next;
-
+            numberOfLevelQuanta = parseNumberList("--level-quanta", argv[i] + 15, levelQuanta, MLFQ_MAX_LEVELS, 1, INT_MAX);
+        }
+        else if (strncmp(argv[i], "--boost-interval=", 17) == 0)
+        {
+            parseNumberList("--boost-interval", argv[i] + 17, &boost_interval, 1, 1, INT_MAX);
+        }
+        else if (strncmp(argv[i], "--target-latency=", 17) == 0)
+        {
+            parseNumberList("--target-latency", argv[i] + 17, &target_latency, 1, 1, INT_MAX);
+        }
+        else if (strncmp(argv[i], "--min-granularity=", 18) == 0)
+        {
+            parseNumberList("--min-granularity", argv[i] + 18, &min_granularity, 1, 1, INT_MAX);
+        }
+        else if (strncmp(argv[i], "--", 2) == 0)
+        {
+            fprintf(stderr, "unknown option %s\n", argv[i]);
+            exit(-1);
+        }
+        // exits if there is too much command line arguments
+        else if (argumentCount == 5)
+        {
+            perror("too many arguments!\n");
+            exit(-1);
         }
-        // if queue has only 1 node, sets head and tail to null
         else
         {
-            ReadyQueue->Head = NULL;
-            ReadyQueue->Tail = NULL;
+            arguments[argumentCount++] = argv[i];
         }
-
-        //decrements the size of the queue
-        ReadyQueue->size--;
-
-        //frees up memory allociated for the head node
-        free(ptr);
-
-        //returns process that was at the front of the queue
-        return frontProcess;
     }
 
-}
-
-//function that returns the size of the queue
-//parameters a pointer to a queue
-//returns the size of the queue inputted
-int getQueueSize(Queue_t *ReadyQueue)
-{
-    return ReadyQueue->size;
-}
-
-/* ========================================================
- * KERNEL SIMULATOR IMPLEMENTATION
- */ =======================================================
-
-//input file related functions
-int countNumberOfProcesses();
-void readInputFile(process_t *processes, char *inputFile, int memory_scheme);
-
-//helper function for getting the string equivalent of enums
-const char *getStringFromState(States state);
-
-//output file related functions
-FILE *outputFileInit();
-void printTransition(FILE *outputFile, int clock, process_t process, States prevState);
-void print_memory_information(FILE *outputFile, int partitions[][2] , int memory_scheme);
-
-// function for printing details of the process (for debugging)
-void print_process_details(process_t process);
-
-//checks if kernel simulator is done
-bool isDone(process_t *processes, int processCount);
-
-//clean up
-void cleanOutputFile(FILE *outputFile);
-
-//function for dispatching processes based on the schedule algorithm
-//mode is 1 for FCFS, mode is 2 for priority scheduling, mode is 3 for round robin with 10ms timeout
-process_t * dispatcher(int mode);
-
-//function for allocating memory to processes or freeing memory,
-//it will allocate a free partition if a partition is available, otherwise it will return -1
-//the function will also free memory when a process is terminated 
-int memory_manager(int partitions[][2], int command, process_t* process, int memory_scheme );
-
-//variable for 100ms timeout assuming 1 tick is 1 ms
-const int TIMEOUT_AMOUNT = 100; 
-
-//Commands for the memory manager
-const int ALLOCATE = 0;
-const int FREE = 1;
-
-//Preset memory portions for the partitions
-const int MEMORY_SCHEME_1[][2] = {{500,-1},{250,-1},{150,-1},{100,-1}};
-
-const int MEMORY_SCHEME_2[][2] = {{300,-1},{300,-1},{350,-1},{50,-1}};
-
-
-// Main function that runs the kernel simulator
-// Parameters are: the amount of commandline arguements , and an array of strings representing the arguments
-int main(int argc, char *argv[])
-{
-
-    //variables for the inputfile and outputfile names
-    char inputFileName[20];
-    char outputFileName[20];
-
-    //variable for checking which scheduling algorithm is being used
-    // 1 for FCFS, 2 for Priority Scheduling, 3 for Round Robin with 100ms timeout
-    int mode;
-
-    //variable for which memory_scheme to use
-    //set to 0 if unused
-    int memory_scheme = 0;
-
     //no command line argument given -> uses default values for mode, memory_scheme, input and output files
-    if (argc == 1)
+    if (argumentCount == 1)
     {
-        strcpy(inputFileName, "input.txt");
-        strcpy(outputFileName, "output.txt");
-
         mode = 1;
         memory_scheme = 0;
 
     }
     //1 command line argument given -> uses given value for mode, 
     //and default values for  memory_scheme, input and output filenames
-    else if (argc == 2)
+    else if (argumentCount == 2)
     {
 
-        //strcpy(inputFileName, argv[1]);
-
-        mode = atoi(argv[1]);
+        mode = parseArgument("mode", arguments[1], 1, LAST_MODE);
 
         memory_scheme = 0;
-
-        strcpy(inputFileName, "input.txt");
-        strcpy(outputFileName, "output.txt");
     }
     //2 command line argument given -> uses given values for mode and memory_scheme
     //and default values for input and output filenames
-    else if (argc == 3)
+    else if (argumentCount == 3)
     {
         
-        mode = atoi(argv[1]);
+        mode = parseArgument("mode", arguments[1], 1, LAST_MODE);
 
-        memory_scheme = atoi(argv[2]);
-
-        strcpy(inputFileName, "input.txt");
-        strcpy(outputFileName, "output.txt");
+        memory_scheme = parseArgument("memory_scheme", arguments[2], 0, LAST_MEMORY_SCHEME);
 
     //3 command line argument given -> uses given values for mode, memory_scheme, and input filename
     //and default values for output filename
-    }else if (argc == 4)
+    }else if (argumentCount == 4)
     {
 
-        mode = atoi(argv[1]);
+        mode = parseArgument("mode", arguments[1], 1, LAST_MODE);
 
-        memory_scheme = atoi(argv[2]);
+        memory_scheme = parseArgument("memory_scheme", arguments[2], 0, LAST_MEMORY_SCHEME);
 
-        strcpy(inputFileName, argv[3]);
-        strcpy(outputFileName,"output.txt");
+        inputFileName = arguments[3];
     } 
     //4 command line argument given -> uses given values for mode, memory_scheme, input filename and output filename
-    else if (argc == 5)
+    else
     {
 
-        mode = atoi(argv[1]);
+        mode = parseArgument("mode", arguments[1], 1, LAST_MODE);
 
-        memory_scheme = atoi(argv[2]);
+        memory_scheme = parseArgument("memory_scheme", arguments[2], 0, LAST_MEMORY_SCHEME);
 
-        strcpy(inputFileName, argv[3]);
-        strcpy(outputFileName, argv[4]);
+        inputFileName = arguments[3];
+        outputFileName = arguments[4];
     }
-     // exits if there is too much command line arguments
-    else
+
+    //the simulation, all of its state is kept in the simulation context
+    Simulator_t *sim = createSimulator(mode, memory_scheme, quantum, aging_interval);
+
+    if (sim == NULL)
     {
-        perror("too many arguments!\n");
+        fprintf(stderr, "the quantum and the aging interval have to be at least 1 tick\n");
         exit(-1);
     }
 
-    //variable to hold partition information
-    int partitions[4][2];
-
-    //double for loop to initial the partitions array to the correct sizes
-    if(memory_scheme == 1 || memory_scheme == 2 ){
-
-        for(int j = 0; j < 4; j++){
-
-            for(int k = 0; k < 2; k++){
-
-                if (memory_scheme == 1)
-                {
-                    partitions[j][k] = MEMORY_SCHEME_1[j][k];
-                }
-                else
-                {
-                    partitions[j][k]  = MEMORY_SCHEME_2[j][k];
-                }
-            }
-        }
+    if (levels == 0)
+    {
+        levels = numberOfLevelQuanta > 0 ? numberOfLevelQuanta : MLFQ_LEVELS;
     }
 
+    if (numberOfLevelQuanta > levels)
+    {
+        fprintf(stderr, "--level-quanta gives more quanta than there are levels\n");
+        exit(-1);
+    }
 
-    //initializes the ready queue for keeping track of the order of processes
-    Queue_t *ReadyQueue = initReadyQueue();
-
-    // gets the current number of processes from the input file
-    int numberOfProcesses = countNumberOfProcesses(inputFileName);
-
-    //dynamically allocates an array of process structs to hold all the processes
-    process_t *processes = (process_t *)malloc(sizeof(process_t) * numberOfProcesses); //Allocate memory for all process
-
-    // reads the input file and constructs the process structs with the correct values
-    readInputFile(processes, inputFileName, memory_scheme);
-
-    //variable to represent the clock in ticks
-    int clock = 0;
-
-    //initializes output file handle (for interacting with the output file)
-    FILE *outputFile = outputFileInit(outputFileName);
-
-    //initializes the current running process id to -1
-    //ASSUMES process id will never be -1
-    int RunningProcess_ID = -1;
+    //the quantum of every level after the ones given is double the one above it
+    if (numberOfLevelQuanta == 0)
+    {
+        levelQuanta[numberOfLevelQuanta++] = quantum;
+    }
 
-    //variable for tracking if a process will timeout within the Round Robin Algorithm
-    int timeout = 0;
+    for (int level = numberOfLevelQuanta; level < levels; level++)
+    {
+        levelQuanta[level] = levelQuanta[level - 1] > INT_MAX / 2 ? INT_MAX : levelQuanta[level - 1] * 2;
+    }
 
-    //variable for tracking the amount of ticks that have happened
-    int tick_until_aging = 10;
+    setSimulatorLevels(sim, levels, levelQuanta, boost_interval);
+    setSimulatorLatency(sim, target_latency, min_granularity);
 
-    //while loop that runs until all processes are in a terminated state
-    //ASSUMES processes can not have multiple transisitons between states in 1 tick
-    //ASSUMES processes on arrival will go into a ready state before being able to become the running process
-    while (!isDone(processes, numberOfProcesses))
+    //the processes are either streamed into recycled slots as they arrive, or all read at once
+    if (stream)
     {
+        streamSimulatorFile(sim, inputFileName);
+    }
+    else
+    {
+        loadSimulatorFile(sim, inputFileName);
+    }
 
-        //if the scheduing algorithm is the priority scheduler
-        if(mode == 2){
-
-            //update the tick_until_aging variable 
-            tick_until_aging--;
+    //a bad parameter or an input file that can not be read stops the program before the output file is opened
+    exitIfFailed(sim);
 
-            //if tick_until_aging is less than 10, then it is time to 
-            if(tick_until_aging <= 0){
+    //opens the output file, and the accounting file if one is written
+    setSimulatorOutput(sim, outputFileName, trace);
 
-                //reset tick_until_aging 
-                tick_until_aging = 10;
+    if (accountingFileName != NULL)
+    {
+        setSimulatorAccounting(sim, accountingFileName);
+    }
 
-                //age processes in the priority queue
-                age_priority_queue(ReadyQueue);
-            }
-        }
+    exitIfFailed(sim);
 
+    //runs the simulation until all processes are in a terminated state (or the remaining processes can never be
+    //given space in memory)
+    runSimulator(sim, engine);
+    exitIfFailed(sim);
 
-        //Checks if there is no running process and the ready queue is not empty.
-        //If conditions are met, the process within the head node of the ready queue becomes the new process
-        //NOTE: only processes in the READY state can enter the ready queue, and transition to RUNNING when the 
-        //condiions above are met.
-        if (getQueueSize(ReadyQueue) > 0 && RunningProcess_ID == -1)
-        {
+    //prints the scheduling metrics of the run
+    if (summary)
+    {
+        printSimulatorSummary(stdout, sim, summaryJson);
+    }
 
-            //dequeues process from ready queue
-            process_t *process = dequeue(ReadyQueue);
+    //prints where the time of the run went
+    if (stats)
+    {
+        printSimulatorStats(stderr, sim);
+    }
 
-            //updates the running process id variable
-            RunningProcess_ID = process->pid;
+    //Calls the function to clean up any dynamically allocated resources.
+    destroySimulator(sim);
 
-            //resets process's current_time_until_IO variable to its IO frequency
-            process->current_time_until_IO = process->IO_frequency;
+    return 0;
+}
 
-            //resets priority of the process transitioning to running
-            //can be done in this transition because this algorithm does not use preemption so 
-            //the priority of the running is not important.
-            if(mode == 2){
-                //resets process's effective priority variable to its initial priority
-                process->effective_priority = process->initial_priority;
+/* ========================================================
+ * SWEEP RUNNER IMPLEMENTATION
+ * =======================================================
+ */
 
-                //if mode is Round Robin
-            }else if(mode == 3){
-                
-                //reset timeout
-                timeout = 0;
-            }
+//Most values a list given to a sweep option can hold
+#define MAX_SWEEP_VALUES 64
 
-            //saves process's old state
-            States prevState = process->state;
+//An input file of a sweep, parsed once and shared read-only by every scenario that runs it
+typedef struct SweepInput
+{
+    const char *fileName;  // Name of the input file.
+    process_t *processes;  // Processes as loaded, copied by each scenario before it runs.
+    int numberOfProcesses; // Number of processes in the input file.
+    int *arrivalOrder;     // Positions of the processes sorted by arrival time, shared by the scenarios.
+    char error[LOADER_ERROR_SIZE]; // Why the input file could not be loaded (processes is then NULL).
+} SweepInput_t;
+
+//A scenario of a sweep, one simulation of an input file with one combination of the parameters
+typedef struct Scenario
+{
+    SweepInput_t *input;  // Input file the scenario runs.
+    int mode;             // Scheduling algorithm.
+    int memory_scheme;    // Memory scheme, 0 if unused.
+    int quantum;          // Round Robin quantum.
+    int aging_interval;   // Ticks between agings of the priority queue.
+    char *outputFileName; // Result file the transitions are printed to.
+    char *summary;        // Summary of the run as one line of JSON, NULL until the scenario has run.
+    char *error;          // Why the scenario failed, NULL if it ran (a failed scenario has no summary).
+} Scenario_t;
+
+//A sweep, the scenarios are handed out to the workers through the next counter
+typedef struct Sweep
+{
+    Scenario_t *scenarios;  // Every scenario of the grid, in the order the summaries are written.
+    int numberOfScenarios;  // Number of scenarios.
+    atomic_int next;        // Index of the next scenario a worker takes.
+    Engines engine;         // Engine the scenarios are run with.
+    TraceFormats trace;     // Format of the result files.
+} Sweep_t;
+
+//Function that reads a comma separated list of numbers given to an option
+//parameters are: the option (for errors), the text after the '=', the array the numbers are stored in,
+//the most numbers the array holds, and the smallest and the largest number allowed
+//returns the number of numbers read
+int parseNumberList(const char *option, const char *text, int *values, int maxValues, int minimum, int maximum)
+{
+    int count = 0;
+    const char *current = text;
 
-            //updates the process's state
-            process->state = RUNNING;
+    while (true)
+    {
+        char *end;
 
-            //prints transition to output file
-            printTransition(outputFile, clock, *process, prevState);
-        }
+        errno = 0;
+        long value = strtol(current, &end, 10);
 
-        //for loop that iterates through all the processes in the array of processes
-        for (int i = 0; i < numberOfProcesses; i++)
+        //every entry has to be a whole number in range, and there is room for so many entries
+        if (end == current || errno != 0 || value < minimum || value > maximum || (*end != ',' && *end != '\0'))
         {
-
-            //if the process is in the NEW state
-            if (processes[i].state == NEW)
+            if (maximum == INT_MAX)
             {
-
-                //if its the processes arrival time, the process transitions to the READY state
-                if (processes[i].arrival_time <= clock )
-                {
-
-
-                    if(memory_scheme != 0 && memory_manager(partitions,ALLOCATE,&processes[i], memory_scheme) == -1){
-                        continue;
-                    }
-
-                    //saves process's old state
-                    States prevState = processes[i].state;
-
-                    //updates the process's state
-                    processes[i].state = READY;
-
-                    //if scheduling algorithm is priority scheduling 
-                    if(mode == 2){
-
-                        //enqueues process onto a priority ready queue
-                        priority_enqueue(ReadyQueue, &processes[i]);
-
-                    // enqueues process onto normal queue if the scheduling algorithm is FCFS or Round Robin
-                    }else{
-
-                        //enqueues process onto the ready queue
-                        enqueue(ReadyQueue, &processes[i]);
-
-                    }
-
-                    //prints transition to output file
-                    printTransition(outputFile, clock, processes[i], prevState);
-
-                    if( memory_scheme != 0){
-                        print_memory_information(outputFile, partitions, memory_scheme);
-                    }
-                }
+                fprintf(stderr, "%s expects a comma separated list of numbers of at least %d, got %s\n", option, minimum, text);
             }
-            //if the process is in the RUNNING state
-            else if (processes[i].state == RUNNING)
+            else
             {
-
-               
-                // if a running process finishes it's task, it transitions to the TERMINATED state
-                if (processes[i].current_CPU_time_needed == 0)
-                {
-                    //saves process's old state
-                    States prevState = processes[i].state;
-
-                    //updates the process's state
-                    processes[i].state = TERMINATED;
-
-                    //resets the current running process id to -1, symbolizing there is currently no running process
-                    RunningProcess_ID = -1;
-
-                    //prints transition to output file
-                    printTransition(outputFile, clock, processes[i], prevState);
-
-                    memory_manager(partitions,FREE, &processes[i], memory_scheme);
-
-                }
-                //if a running process needs IO, it transitions to the WAITING state
-                else if (processes[i].current_time_until_IO == 0)
-                {
-                    //saves process's old state
-                    States prevState = processes[i].state;
-
-                    //updates the process's state
-                    processes[i].state = WAITING;
-
-                    //resets the current running process id to -1, symbolizing there is currently no running process
-                    RunningProcess_ID = -1;
-
-                    //prints transition to output file
-                    printTransition(outputFile, clock, processes[i], prevState);
-                }
-                // if it isn't time to request IO and the process's task has not finished
-                // decrements the process's current_time_until_IO and current_CPU_time_needed variables
-                else
-                {
-
-                    //if schedule algorithm being used is the Round Robin algorithm
-                    if (mode == 3)
-                    {
-
-                        //if timeout variable is greater or equal to 100ms, then the process gets timed out and
-                        //goes back to the ready queue
-                        if (timeout == TIMEOUT_AMOUNT && processes[i].current_CPU_time_needed != 0)
-                        {
-
-                            //saves process's old state
-                            States prevState = processes[i].state;
-
-                            //updates the process's state
-                            processes[i].state = READY;
-
-                            //resets the current running process id to -1, symbolizing there is currently no running process
-                            RunningProcess_ID = -1;
-
-                            //enqueue the ready process
-                            enqueue(ReadyQueue, &processes[i]);
-
-                            //prints transition to output file
-                            printTransition(outputFile, clock, processes[i], prevState);
-
-                            continue;
-                        }
-
-                        //increment the timeout variable
-                        timeout++;
-                    }
-
-                    processes[i].current_time_until_IO--;
-                    processes[i].current_CPU_time_needed--;
-                }
+                fprintf(stderr, "%s expects a comma separated list of numbers from %d to %d, got %s\n", option, minimum,
+                        maximum, text);
             }
-            //if the process is in the WAITING state
-            else if (processes[i].state == WAITING)
-            {
-
-                // if a waiting process is done with IO, it transitions to the READY state and gets enqueued
-                if (processes[i].current_time_until_IO_is_finished == 0)
-                {
-                    //saves process's old state
-                    States prevState = processes[i].state;
 
-                    //updates the process's state
-                    processes[i].state = READY;
-
-                    if(mode == 2){
-
-                        //enqueues process onto a priority ready queue
-                        priority_enqueue(ReadyQueue, &processes[i]);
-
-                    // enqueues process onto normal queue if the scheduling algorithm is FCFS or Round Robin
-                    }else{
+            printUsage();
+            exit(-1);
+        }
 
-                        //enqueues process onto the ready queue
-                        enqueue(ReadyQueue, &processes[i]);
+        if (count == maxValues)
+        {
+            fprintf(stderr, "%s takes at most %d numbers\n", option, maxValues);
+            exit(-1);
+        }
 
-                    }
+        values[count++] = (int)value;
 
-                    //prints transition to output file
-                    printTransition(outputFile, clock, processes[i], prevState);
-                }
-                // if a waiting process is not done with IO, decrements process's current_time_until_IO_is_finished variable
-                else
-                {
-                    processes[i].current_time_until_IO_is_finished--;
-                }
-            }
-            
-            //if the process is in the READY state
-            else if (processes[i].state == READY)
-            {
-                //Mechanism for switching the current running process is out of the for loop.
-                //Waits and does nothing while process is ready until process is at the front of the ready queue
-                //and the current running process transistions out of the RUNNING state (requests I/O or finishes it's task) 
-                continue;
-            }
-            //if the process is in the TERMINATED state
-            else if (processes[i].state == TERMINATED)
-            {
-                
-                // Nothing to do with a terminated process
-                continue;
-            }
-            //if a state is reached that is not defined, exits the program and prints the error
-            else
-            {
-                perror("ERROR: Process state is unknown!\n");
-                exit(-1);
-            }
+        if (*end == '\0')
+        {
+            return count;
         }
 
-        //increments the value of the clock to represent time has elapsed
-        clock++;
+        current = end + 1;
     }
-
-    //Calls functions to clean up any dynamically allocated resources.
-    cleanOutputFile(outputFile);
-    cleanReadyQueue(ReadyQueue);
-    free(processes);
-
-    return 0;
 }
 
-//Function to clean up and close the output file
-//parametesr are: a pointer to the output file
-//returns nothing
-FILE *outputFileInit(char *outputFile)
+//Function that returns the name of a file without its directory and its extension
+//parameters are: the path of the file
+//returns the name (freed by the caller)
+static char *baseName(const char *path)
 {
+    const char *start = strrchr(path, '/');
+    start = start != NULL ? start + 1 : path;
 
-    FILE *outputFIle = fopen(outputFile, "w"); // opens file in current working directory in write mode
-                                               // if the file does not exist, it will create the file
+    const char *end = strrchr(start, '.');
 
-    if (outputFIle == NULL)
-    { //Check if file opened properly
-        perror("Could not open file.");
-        exit(1);
+    //a leading dot (a hidden file) is not an extension
+    if (end == NULL || end == start)
+    {
+        end = start + strlen(start);
     }
 
-    //returns pointer to output file
-    return outputFIle;
+    size_t length = (size_t)(end - start);
+    char *name = (char *)malloc(length + 1);
+
+    memcpy(name, start, length);
+    name[length] = '\0';
+
+    return name;
 }
 
-//Function to clean up and close the output file
-//parametesr are: a pointer to the output file
+//Method that prints a string as a JSON string (quoted, with quotes, backslashes and control characters escaped)
+//parameters are: the file and the string
 //returns nothing
-void cleanOutputFile(FILE *outputFile)
+static void printJsonString(FILE *file, const char *text)
 {
-    //closes the output file
-    fclose(outputFile);
+    fputc('"', file);
+
+    for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; c++)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            fprintf(file, "\\%c", *c);
+        }
+        else if (*c < 0x20)
+        {
+            fprintf(file, "\\u%04x", *c);
+        }
+        else
+        {
+            fputc(*c, file);
+        }
+    }
+
+    fputc('"', file);
 }
 
-//Function to print transitions in a processes state to an output file
-//parametesr are: a pointer to the output file, the current tick, the process that had a transition in state, and a State enum for the previous state
+//Method that runs one scenario of a sweep on a copy of its input's processes, and keeps its summary
+//a scenario that fails (its input could not be loaded, or its processes never fit in memory) only keeps its error,
+//the other scenarios still run
+//parameters are: the sweep and the scenario
 //returns nothing
-void printTransition(FILE *outputFile, int clock, process_t process, States prevState)
+static void runScenario(Sweep_t *sweep, Scenario_t *scenario)
 {
-    //prints process transisiton with the current time and process id to the output file
-    fprintf(outputFile, " %d %d %s %s \n", clock, process.pid, getStringFromState((States)prevState), getStringFromState((States)process.state));
-};
+    SweepInput_t *input = scenario->input;
 
+    if (input->processes == NULL)
+    {
+        scenario->error = strdup(input->error);
+        return;
+    }
 
+    Simulator_t *sim = createSimulator(scenario->mode, scenario->memory_scheme, scenario->quantum, scenario->aging_interval);
 
-void print_memory_information(FILE *outputFile, int partitions[4][2] , int memory_scheme){
-    
-
-    //
-    //  **********************
-    //  Total Memory Used: %d MB | Free Memory Available: %d MB | Usable Memory: MB
-    //
-    //  Partitions Available: 
-    //  Partition 1 (%d MB) Available? Yes/No
-    //  Partition 2 (%d MB) Available? Yes/No
-    //  Partition 3 (%d MB) Available? Yes/No
-    //  Partition 4 (%d MB) Available? Yes/No
-    //  ***************************
-    //
-    //
-    //
-
+    //the grid is checked when it is read, so this only happens for parameters out of range
+    if (sim == NULL)
+    {
+        scenario->error = strdup("the mode, memory scheme, quantum or aging interval is out of range");
+        return;
+    }
 
-    //variable for calculating the amount of free memory available
-    int total_free_memory_available = 0;
+    //the simulation gets its own copy of the processes, the arrival order is only read
+    loadSimulatorProcesses(sim, input->processes, input->numberOfProcesses, input->arrivalOrder);
+    setSimulatorOutput(sim, scenario->outputFileName, sweep->trace);
 
-    //variable for calculating the amount of usable memory available
-    int total_usable_memory_available = 0;
+    //the result file keeps the transitions up to the failure
+    if (!runSimulator(sim, sweep->engine))
+    {
+        scenario->error = strdup(getSimulatorError(sim));
+        destroySimulator(sim);
+        return;
+    }
 
-    //variable for calculating the amount of used memory
-    int memory_used = 0;
+    //the summary is printed into memory and written out with the others once every scenario has run
+    size_t length;
+    FILE *summary = open_memstream(&scenario->summary, &length);
 
-    //for loop that iterates through the partitions
-    for (int i = 0; i < 4; i++)
+    if (summary == NULL)
     {
-        //adds the remaining space in each partition to total_free_memory_available
-        total_free_memory_available += partitions[i][0];
-
-        //adds the memory used by calculating the difference between the capacity of each partition and 
-        //the current remaining space (depends on the memory portions assigned)
-        if(memory_scheme == 1){
-            memory_used += (MEMORY_SCHEME_1[i][0] - partitions[i][0]);
-        }else{
-            memory_used += (MEMORY_SCHEME_2[i][0] - partitions[i][0]);
-        }
-
-        //adds the remaining space in each availble partition to total_usable_memory_available
-        //after checking if the partition is currently usable
-        if(partitions[i][1] == -1){
-            total_usable_memory_available += partitions[i][0];
-        }
+        perror("Error could not keep the summary of a scenario");
+        exit(-1);
     }
 
+    printSimulatorSummary(summary, sim, true);
+    fclose(summary);
 
-    //prints formatted information to the file
-    fprintf(outputFile,"\n************************ \n");
-
-    fprintf(outputFile,"Total Memory Used: %d MB | Free Memory Available: %d MB | Usable Memory: %d MB \n", memory_used, total_free_memory_available, total_usable_memory_available);
+    //drops the newline, the summary goes inside a line of the combined summary
+    if (length > 0 && scenario->summary[length - 1] == '\n')
+    {
+        scenario->summary[length - 1] = '\0';
+    }
 
-    fprintf(outputFile,"Partitions Available: \n");
+    destroySimulator(sim);
+}
 
-    // string for printing availability
-    char availability[10];
+//Function run by each worker of a sweep, takes scenarios until there are none left
+//parameters are: the sweep
+//returns nothing (NULL)
+static void *sweepWorker(void *argument)
+{
+    Sweep_t *sweep = (Sweep_t *)argument;
 
-    //for loop that iterates through all the partions
-    for(int i = 0; i < 4 ; i++){
+    while (true)
+    {
+        int index = atomic_fetch_add(&sweep->next, 1);
 
-        //sets the availability to "Yes" if the partion is available and "No" if the partition is not available.
-        if(partitions[i][1] == -1){
-            strcpy(availability,"Yes");
-        }else{
-            strcpy(availability,"No");
+        if (index >= sweep->numberOfScenarios)
+        {
+            return NULL;
         }
 
-        //prints out the availablitiy information of the partition
-        if(memory_scheme == 1){
-           fprintf(outputFile,"Partition %d  %d MB/(%d MB) Available? %s \n", i , partitions[i][0] , MEMORY_SCHEME_1[i][0],  availability );
-        }else{
-           fprintf(outputFile,"Partition %d  %d MB/(%d MB) Available? %s \n", i , partitions[i][0] , MEMORY_SCHEME_2[i][0], availability );
-        }
-        
+        runScenario(sweep, &sweep->scenarios[index]);
     }
-
-    fprintf(outputFile,"************************ \n\n");
-
 }
 
-
-//Function to count the number of processes in the input file
-//parameter is a string of the name of the inputFile
-//returns the number of processes found in the input file (assuming each line represents a process)
-//ASSUMES : there is no blank lines in the input file
-int countNumberOfProcesses(char *inputFile)
+//Function that runs a sweep over input files and a grid of parameters
+//every input file is parsed once, then every combination of mode, memory scheme, quantum and aging interval is
+//run on every input file by a pool of worker threads, one result file per scenario, and the summaries of all of
+//them are written to summary.jsonl (one line per scenario, in grid order) in the sweep directory
+//parameters are: the amount of commandline arguements, and an array of strings representing the arguments
+//returns 0, or -1 if a scenario failed (the exit code)
+int runSweep(int argc, char *argv[])
 {
-    int processCtr = 0; // initializes process counter
-
-    FILE *file = fopen(inputFile, "r"); // opens input file in current working directory in read mode
-
-    if (file == NULL)
-    { //Checks for file if file opened properly
-        perror("Could not open file.");
-        exit(1);
+    //the grid, by default every mode and memory scheme with the default quantum and aging interval
+    int modes[MAX_SWEEP_VALUES] = {1, 2, 3};
+    int numberOfModes = 3;
+    int schemes[MAX_SWEEP_VALUES] = {0, 1, 2};
+    int numberOfSchemes = 3;
+    int quanta[MAX_SWEEP_VALUES] = {TIMEOUT_AMOUNT};
+    int numberOfQuanta = 1;
+    int agingIntervals[MAX_SWEEP_VALUES] = {AGING_INTERVAL};
+    int numberOfAgingIntervals = 1;
+
+    //variable for the number of worker threads, one per core by default
+    int jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    //variable for the directory the result files and the combined summary are written to
+    const char *sweepDirectory = "sweep";
+
+    Engines engine = TICK_ENGINE;
+    TraceFormats trace = TRACE_TEXT;
+
+    //the arguments that are not options are the input files
+    const char **inputFileNames = (const char **)malloc(sizeof(const char *) * (argc > 1 ? argc : 1));
+    int numberOfInputs = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--sweep") == 0)
+        {
+            continue;
+        }
+        else if (strncmp(argv[i], "--modes=", 8) == 0)
+        {
+            numberOfModes = parseNumberList("--modes", argv[i] + 8, modes, MAX_SWEEP_VALUES, 1, LAST_MODE);
+        }
+        else if (strncmp(argv[i], "--schemes=", 10) == 0)
+        {
+            numberOfSchemes = parseNumberList("--schemes", argv[i] + 10, schemes, MAX_SWEEP_VALUES, 0, LAST_MEMORY_SCHEME);
+        }
+        else if (strncmp(argv[i], "--quantum=", 10) == 0)
+        {
+            numberOfQuanta = parseNumberList("--quantum", argv[i] + 10, quanta, MAX_SWEEP_VALUES, 1, INT_MAX);
+        }
+        else if (strncmp(argv[i], "--aging-interval=", 17) == 0)
+        {
+            numberOfAgingIntervals = parseNumberList("--aging-interval", argv[i] + 17, agingIntervals, MAX_SWEEP_VALUES, 1, INT_MAX);
+        }
+        else if (strncmp(argv[i], "--jobs=", 7) == 0)
+        {
+            parseNumberList("--jobs", argv[i] + 7, &jobs, 1, 1, INT_MAX);
+        }
+        else if (strncmp(argv[i], "--sweep-dir=", 12) == 0)
+        {
+            sweepDirectory = argv[i] + 12;
+        }
+        else if (strcmp(argv[i], "--engine=tick") == 0)
+        {
+            engine = TICK_ENGINE;
+        }
+        else if (strcmp(argv[i], "--engine=event") == 0)
+        {
+            engine = EVENT_ENGINE;
+        }
+        else if (strcmp(argv[i], "--trace=text") == 0)
+        {
+            trace = TRACE_TEXT;
+        }
+        else if (strcmp(argv[i], "--trace=binary") == 0)
+        {
+            trace = TRACE_BINARY;
+        }
+        else if (strcmp(argv[i], "--trace=none") == 0)
+        {
+            trace = TRACE_NONE;
+        }
+        else if (strncmp(argv[i], "--", 2) == 0)
+        {
+            //--stream, --summary, --accounting, --stats, the MLFQ levels and the CFS latency are for single runs
+            fprintf(stderr, "option %s can not be used with --sweep\n", argv[i]);
+            exit(-1);
+        }
+        else
+        {
+            inputFileNames[numberOfInputs++] = argv[i];
+        }
     }
 
-    char input_line[100]; // input buffer for reading from the file
-
-    //while loop that reads the input file (line by line) until the end of file is
-    while (fgets(input_line, sizeof(input_line), file))
+    //sweeps the default input file if none is given
+    if (numberOfInputs == 0)
     {
-        processCtr++; //Increment process counter for each line read
+        inputFileNames[numberOfInputs++] = "input.txt";
     }
 
-    //closes input file when finished
-    fclose(file);
-
-    //returns the number of processes found in the input file
-    return processCtr;
-}
+    //the memory needed is read whenever one of the memory schemes of the grid needs it
+    int loadScheme = 0;
 
-//Function to check if all the processes have finished executing
-//parameters are an array of processes and the total number of processes in the array
-//returns true if all processes are in a TERMINATED state and false otherwise
-bool isDone(process_t *processes, int processCount)
-{
-
-    //for loop to iterate through the array of process structs
-    for (int i = 0; i < processCount; i++)
+    for (int i = 0; i < numberOfSchemes; i++)
     {
-        //retuns false if a process is not in the TERMINATED state
-        if (processes[i].state != TERMINATED)
+        if (schemes[i] != 0)
         {
-            return false;
+            loadScheme = schemes[i];
         }
     }
 
-    //returns true if all processes are in the TERMINATED state
-    return true;
-}
-
-
-//function for allocating memory or freeing memory from partitions
-//parameters are a partition array, the command the partition is doing, and the process
-//that is being allocated or freed from memory
-//returns 0 if successful in allocating memory and returns -1 if there was no space for the process in memory
-//returns 2 if successful in freeing memory
-int memory_manager(int partitions[][2], int command, process_t* process, int memory_scheme ){
+    //creates the sweep directory if it does not exist yet
+    if (mkdir(sweepDirectory, 0777) != 0 && errno != EEXIST)
+    {
+        perror("Error could not create the sweep directory");
+        exit(-1);
+    }
 
-    //memory manager attempts to allocates memory if it receives the allocate command
-    //Uses the first fit algothrim for implementation simplicity
-    if(command == ALLOCATE){
+    //parses every input file once
+    SweepInput_t *inputs = (SweepInput_t *)malloc(sizeof(SweepInput_t) * numberOfInputs);
+    char **baseNames = (char **)malloc(sizeof(char *) * numberOfInputs);
 
-        //sets initial value for partition_for_process
-        int partition_for_process = -1;
+    for (int i = 0; i < numberOfInputs; i++)
+    {
+        inputs[i].fileName = inputFileNames[i];
+        inputs[i].processes = loadProcesses(inputFileNames[i], loadScheme, &inputs[i].numberOfProcesses, inputs[i].error);
+        inputs[i].arrivalOrder = NULL;
 
-        for(int i = 0; i < 4; i++){
+        //an input file that can not be loaded fails its own scenarios only
+        if (inputs[i].processes != NULL)
+        {
+            inputs[i].arrivalOrder = sortByArrival(inputs[i].processes, inputs[i].numberOfProcesses);
+        }
 
-            if( partitions[i][1] == -1 && process->memory_needed <= partitions[i][0]){
-                partition_for_process = i;
+        baseNames[i] = baseName(inputFileNames[i]);
 
-                break;
+        //the result files are named after the input files, two inputs with the same name would overwrite them
+        for (int j = 0; j < i; j++)
+        {
+            if (strcmp(baseNames[i], baseNames[j]) == 0)
+            {
+                fprintf(stderr, "inputs %s and %s would write the same result files\n", inputFileNames[j], inputFileNames[i]);
+                exit(-1);
             }
         }
+    }
 
-        // if partition_for_process is at the initial value, the memory manager couldn't find space for the process
-        if(partition_for_process == -1){
-
-            //returns -1 because the memory manager couldn't find space for the process
-            return -1;
-
-
-            //memory manager found space for the process
-        }else{
-            
-            //memory manager updates the information about memory usage within the partition
-            partitions[partition_for_process][0] -= process->memory_needed;
+    //lays out the grid, inputs first, then modes, memory schemes, quanta and aging intervals
+    Sweep_t sweep;
 
-            //memory manager updates the information about availability within the partition
-            partitions[partition_for_process][1] = 1;
+    sweep.numberOfScenarios = numberOfInputs * numberOfModes * numberOfSchemes * numberOfQuanta * numberOfAgingIntervals;
+    sweep.scenarios = (Scenario_t *)malloc(sizeof(Scenario_t) * sweep.numberOfScenarios);
+    sweep.engine = engine;
+    sweep.trace = trace;
+    atomic_init(&sweep.next, 0);
 
-            //memory manager updates the information about memory position within the process
-            process->partition_used = partition_for_process;
+    const char *extension = trace == TRACE_BINARY ? "bin" : "txt";
+    int count = 0;
 
-            return 0;
+    for (int i = 0; i < numberOfInputs; i++)
+    {
+        for (int m = 0; m < numberOfModes; m++)
+        {
+            for (int s = 0; s < numberOfSchemes; s++)
+            {
+                for (int q = 0; q < numberOfQuanta; q++)
+                {
+                    for (int a = 0; a < numberOfAgingIntervals; a++)
+                    {
+                        Scenario_t *scenario = &sweep.scenarios[count++];
+
+                        scenario->input = &inputs[i];
+                        scenario->mode = modes[m];
+                        scenario->memory_scheme = schemes[s];
+                        scenario->quantum = quanta[q];
+                        scenario->aging_interval = agingIntervals[a];
+                        scenario->summary = NULL;
+                        scenario->error = NULL;
+
+                        //sized by a first call that prints nothing
+                        int length = snprintf(NULL, 0, "%s/%s_m%d_s%d_q%d_a%d.%s", sweepDirectory, baseNames[i],
+                                              modes[m], schemes[s], quanta[q], agingIntervals[a], extension);
+                        scenario->outputFileName = (char *)malloc(length + 1);
+                        snprintf(scenario->outputFileName, length + 1, "%s/%s_m%d_s%d_q%d_a%d.%s", sweepDirectory, baseNames[i],
+                                 modes[m], schemes[s], quanta[q], agingIntervals[a], extension);
+                    }
+                }
+            }
         }
+    }
 
+    //no more workers than scenarios
+    if (jobs > sweep.numberOfScenarios)
+    {
+        jobs = sweep.numberOfScenarios;
+    }
 
-    //memory manager attempts to free memory if it receives the allocate command
-    //used for freeing memory from terminated processes
-    }else if(command == FREE){
+    //starts the workers and waits until every scenario has run
+    pthread_t *workers = (pthread_t *)malloc(sizeof(pthread_t) * jobs);
 
-        //frees memory based on the current memory scheme
-        if(memory_scheme == 1){
-            partitions[process->partition_used][0] = MEMORY_SCHEME_1[process->partition_used][0]; 
-            partitions[process->partition_used][1] = -1;
-        }else{
-            partitions[process->partition_used][0] = MEMORY_SCHEME_2[process->partition_used][0]; 
-            partitions[process->partition_used][1] = -1;
+    for (int i = 0; i < jobs; i++)
+    {
+        if (pthread_create(&workers[i], NULL, sweepWorker, &sweep) != 0)
+        {
+            perror("Error could not start a sweep worker");
+            exit(-1);
         }
-
-        return 2;
-
-    //if the memory manager gets an unknown command
-    }else{
-        perror("Memory manager could not handle unknown command");
-        exit(1);
     }
 
-}
-
-
-//function for getting the string equivalent of a States Enum
-//parameter is an a State Enum
-//returns a string
-const char *getStringFromState(States state)
-{
-    //array of strings corresponding to the Process State Enum s
-    static const char *states[] = {"NEW", "READY", "RUNNING", "WAITING", "TERMINATED"};
-
-    //returns string of the state enum
-    return states[state];
-}
-
-//function for printing the details of a process (for debugging)
-//parameters is a process struct
-//returns nothing
-void print_process_details(process_t process)
-{
-    //prints the state of a process for debugging
-    printf("Pid: %d \t, arrival_time: %d \t, total_CPU_time: %d \t, IO_frequency: %d \t, IO_duration: %d \t, state: %s \t \n",
-           process.pid, process.arrival_time, process.total_CPU_time, process.IO_frequency, process.IO_duration, getStringFromState(process.state));
-}
+    for (int i = 0; i < jobs; i++)
+    {
+        pthread_join(workers[i], NULL);
+    }
 
-//function for reading and practing an input file
-//parameters are an array of processes , a string for the name of the input file, and the memory scheme
-//returns nothing
-//ASSUMES : there is no blank lines in the input file
-//If memory scheme is 0, ASSUMES no memory requirement for the processes
-void readInputFile(process_t *processes, char *inputFile, int memory_scheme)
-{
-    char str[100];                //To store the text contained in each line
-    const char truncate[2] = " "; //In-line separator
-    char *token;                  //To store the token for each line
-    int input_parameter = 0;      //To traverse through the different output parameters (i.e., execution time, etc.) Set to zero for first token
-    int process_position = 0;     //To traverse through the words in each line
+    //writes the combined summary, one line per scenario in grid order
+    int length = snprintf(NULL, 0, "%s/summary.jsonl", sweepDirectory);
+    char *summaryFileName = (char *)malloc(length + 1);
+    snprintf(summaryFileName, length + 1, "%s/summary.jsonl", sweepDirectory);
 
-    FILE *file = fopen(inputFile, "r"); //Opens the input file within current working directory in read mode
+    FILE *summaryFile = fopen(summaryFileName, "w");
 
-    // If file could not open, prints the error and exits
-    if (file == NULL)
+    if (summaryFile == NULL)
     {
-        perror("Could not open file.");
-        exit(1);
+        perror("Error could not open the sweep summary");
+        exit(-1);
     }
 
-    //while loop that keeps reading the file (line by line) until the end is reached, stores the contents of the line in str
-    while (fgets(str, sizeof(str), file))
+    int failed = 0;
+
+    for (int i = 0; i < sweep.numberOfScenarios; i++)
     {
+        Scenario_t *scenario = &sweep.scenarios[i];
 
-        token = strtok(str, truncate); //Break input into a series of tokens
+        fputs("{\"input\":", summaryFile);
+        printJsonString(summaryFile, scenario->input->fileName);
+        fputs(",\"output\":", summaryFile);
 
-        while (token != NULL)
+        //no result file is written without a trace
+        if (trace == TRACE_NONE)
+        {
+            fputs("null", summaryFile);
+        }
+        else
         {
-            int int_token = atoi(token); //Converts string to integer representation
+            printJsonString(summaryFile, scenario->outputFileName);
+        }
 
-            // if statements to set the members of the process struct according to the input from the file
-            if (input_parameter == 0)
-            {
-                processes[process_position].pid = int_token;
-            }
-            else if (input_parameter == 1)
-            {
-                processes[process_position].arrival_time = int_token;
-            }
-            else if (input_parameter == 2)
-            {
-                processes[process_position].total_CPU_time = int_token;
-            }
-            else if (input_parameter == 3)
-            {
-                processes[process_position].IO_frequency = int_token;
-            }
-            else if (input_parameter == 4)
-            {
-                processes[process_position].IO_duration = int_token;
-            }
-            else if (input_parameter == 5)
-            {
-                processes[process_position].initial_priority = int_token;
-            }
-            else if ( memory_scheme != 0 && input_parameter == 6)
-            {
-                processes[process_position].memory_needed = int_token;
-            }
+        //a failed scenario has no summary, its line says why it failed instead
+        if (scenario->error != NULL)
+        {
+            fputs(",\"summary\":null,\"failed\":", summaryFile);
+            printJsonString(summaryFile, scenario->error);
+            fputs("}\n", summaryFile);
 
-            token = strtok(NULL, truncate); //Reset token
-            input_parameter++;              //Increment input parameter position counter
+            fprintf(stderr, "ERROR: %s (%s): %s\n", scenario->input->fileName, scenario->outputFileName, scenario->error);
+            failed++;
+        }
+        else
+        {
+            fprintf(summaryFile, ",\"summary\":%s}\n", scenario->summary);
         }
+    }
 
-        //sets new processes to initially be in a NEW state
-        processes[process_position].state = NEW;
+    fclose(summaryFile);
 
-        //initializes variables used to track cpu time, time until IO, and current IO duration
-        processes[process_position].current_CPU_time_needed = processes[process_position].total_CPU_time;
-        processes[process_position].current_time_until_IO_is_finished = processes[process_position].IO_duration;
-        processes[process_position].current_time_until_IO = processes[process_position].IO_frequency;
-        processes[process_position].effective_priority = processes[process_position].initial_priority;
-        processes[process_position].partition_used = -1;
+    printf("%d scenarios run on %d workers, %d failed, summaries in %s\n", sweep.numberOfScenarios, jobs, failed, summaryFileName);
 
-        input_parameter = 0; //Reset input parameter counter
-        process_position++;  //Increment the process position counter to point to the next process in the array of processes
+    //cleans up the scenarios and the shared inputs
+    for (int i = 0; i < sweep.numberOfScenarios; i++)
+    {
+        free(sweep.scenarios[i].outputFileName);
+        free(sweep.scenarios[i].summary);
+        free(sweep.scenarios[i].error);
     }
 
-    //closes the input file
-    fclose(file);
+    for (int i = 0; i < numberOfInputs; i++)
+    {
+        free(inputs[i].processes);
+        free(inputs[i].arrivalOrder);
+        free(baseNames[i]);
+    }
+
+    free(sweep.scenarios);
+    free(inputs);
+    free(baseNames);
+    free(inputFileNames);
+    free(workers);
+    free(summaryFileName);
+
+    //the exit status says if any scenario failed
+    return failed > 0 ? -1 : 0;
 }
 
 //REFERENCES:-
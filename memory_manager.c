@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "memory_manager.h"
+#include "memory_schemes.h"
+
+//function for allocating memory or freeing memory from partitions
+//parameters are a partition array, the command the partition is doing, and the process
+//that is being allocated or freed from memory
+//returns 0 if successful in allocating memory and returns -1 if there was no space for the process in memory
+//returns 2 if successful in freeing memory
+int memory_manager(int partitions[][2], int command, process_t* process, int memory_scheme ){
+
+    //memory manager attempts to allocates memory if it receives the allocate command
+    //Uses the first fit algothrim for implementation simplicity
+    if(command == ALLOCATE){
+
+        //sets initial value for partition_for_process
+        int partition_for_process = -1;
+
+        for(int i = 0; i < 4; i++){
+
+            if( partitions[i][1] == -1 && process->memory_needed <= partitions[i][0]){
+                partition_for_process = i;
+
+                break;
+            }
+        }
+
+        // if partition_for_process is at the initial value, the memory manager couldn't find space for the process
+        if(partition_for_process == -1){
+
+            //returns -1 because the memory manager couldn't find space for the process
+            return -1;
+
+
+            //memory manager found space for the process
+        }else{
+            
+            //memory manager updates the information about memory usage within the partition
+            partitions[partition_for_process][0] -= process->memory_needed;
+
+            //memory manager updates the information about availability within the partition
+            partitions[partition_for_process][1] = 1;
+
+            //memory manager updates the information about memory position within the process
+            process->partition_used = partition_for_process;
+
+            return 0;
+        }
+
+
+    //memory manager attempts to free memory if it receives the allocate command
+    //used for freeing memory from terminated processes
+    }else if(command == FREE){
+
+        //frees memory based on the current memory scheme
+        if(memory_scheme == 1){
+            partitions[process->partition_used][0] = MEMORY_SCHEME_1[process->partition_used][0]; 
+            partitions[process->partition_used][1] = -1;
+        }else{
+            partitions[process->partition_used][0] = MEMORY_SCHEME_2[process->partition_used][0]; 
+            partitions[process->partition_used][1] = -1;
+        }
+
+        return 2;
+
+    //assertion: the simulator only sends the commands above, an unknown command is a bug and exits
+    }else{
+        perror("Memory manager could not handle unknown command");
+        exit(1);
+    }
+
+}
@@ -0,0 +1,20 @@
+#ifndef MEMORY_MANAGER_H
+#define MEMORY_MANAGER_H
+
+#include "process.h"
+
+/* ======================================================
+ * MEMORY MANAGER IMPLEMENTATION
+ * ======================================================
+ */
+
+//Commands for the memory manager
+static const int ALLOCATE = 0;
+static const int FREE = 1;
+
+//function for allocating memory to processes or freeing memory,
+//it will allocate a free partition if a partition is available, otherwise it will return -1
+//the function will also free memory when a process is terminated 
+int memory_manager(int partitions[][2], int command, process_t* process, int memory_scheme );
+
+#endif //MEMORY_MANAGER_H
@@ -0,0 +1,12 @@
+#ifndef MEMORY_SCHEMES_H
+#define MEMORY_SCHEMES_H
+
+//Number of partitions in every memory scheme
+#define NUMBER_OF_PARTITIONS 4
+
+//Preset memory portions for the partitions (size in MB, and -1 for an available partition)
+static const int MEMORY_SCHEME_1[][2] = {{500,-1},{250,-1},{150,-1},{100,-1}};
+
+static const int MEMORY_SCHEME_2[][2] = {{300,-1},{300,-1},{350,-1},{50,-1}};
+
+#endif //MEMORY_SCHEMES_H
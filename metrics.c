@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "metrics.h"
+
+//Initializing the metrics of a run with no transitions.
+Metrics_t *initMetrics()
+{
+    //Allocating memory for the metrics on the heap, every sum and count starts at 0.
+    Metrics_t *Metrics = (Metrics_t *)malloc(sizeof(Metrics_t));
+
+    memset(Metrics, 0, sizeof(Metrics_t));
+
+    return Metrics;
+}
+
+//Method to clean up the metrics (deallocates the memory on the heap).
+//Parameter:- Metrics, the metrics of a run.
+//Return:- N/A.
+void cleanMetrics(Metrics_t *Metrics)
+{
+    free(Metrics);
+}
+
+//Method that accounts for the time a process spent in the state it leaves, and for the new state it enters.
+//Parameter:- Metrics, the metrics of a run.
+//Parameter:- process, the process, already in its new state.
+//Parameter:- prevState, the state the process leaves.
+//Parameter:- clock, the tick of the transition.
+//Return:- N/A.
+void recordTransition(Metrics_t *Metrics, process_t *process, States prevState, long long clock)
+{
+    //processes arriving before the first tick arrive on tick 0
+    long long arrival = process->arrival_time > 0 ? process->arrival_time : 0;
+
+    Metrics->transitions++;
+
+    //ticks spent in the state the process leaves
+    long long spent = clock - process->state_entered;
+
+    if (prevState == READY)
+    {
+        process->ready_wait += spent;
+    }
+    else if (prevState == RUNNING)
+    {
+        Metrics->busy_ticks += spent;
+
+        //a running process going back to the ready queue was timed out
+        if (process->state == READY)
+        {
+            process->preemptions++;
+        }
+    }
+    else if (prevState == WAITING)
+    {
+        process->io_wait += spent;
+    }
+
+    //the first dispatch of a process ends its response time
+    if (process->state == RUNNING)
+    {
+        if (process->dispatches == 0)
+        {
+            long long response = clock - arrival;
+
+            process->first_run = clock;
+
+            Metrics->responded++;
+            Metrics->total_response += response;
+            recordValue(&Metrics->response, response);
+        }
+
+        process->dispatches++;
+        Metrics->dispatches++;
+    }
+    //a process that terminates has its turnaround and waiting time
+    else if (process->state == TERMINATED)
+    {
+        long long turnaround = clock - arrival;
+
+        Metrics->completed++;
+        Metrics->total_turnaround += turnaround;
+        Metrics->total_waiting += process->ready_wait;
+        recordValue(&Metrics->turnaround, turnaround);
+        recordValue(&Metrics->waiting, process->ready_wait);
+
+        //a process with a deadline that terminates after it is late by the ticks in between
+        if (process->relative_deadline > 0)
+        {
+            long long lateness = turnaround - process->relative_deadline;
+
+            Metrics->deadlines++;
+
+            if (lateness > 0)
+            {
+                Metrics->deadline_misses++;
+                Metrics->total_lateness += lateness;
+                recordValue(&Metrics->lateness, lateness);
+            }
+        }
+    }
+
+    process->state_entered = clock;
+    Metrics->end_tick = clock;
+}
+
+//Function that divides two totals for an average, 0 if there is nothing to divide by
+static double average(long long total, long long count)
+{
+    return count > 0 ? (double)total / (double)count : 0.0;
+}
+
+//Fractions the percentiles of the summary are taken at, and their names
+static const double PERCENTILES[] = {0.5, 0.9, 0.99, 0.999};
+static const char *PERCENTILE_NAMES[] = {"p50", "p90", "p99", "p99.9"};
+#define NUMBER_OF_PERCENTILES 4
+
+//Method that prints the mean and percentiles of one of the times
+//parameters are the file, the name of the time, its total, the number of values and its histogram, and the format
+static void printTime(FILE *file, const char *name, long long total, long long count, Histogram_t *histogram, bool json)
+{
+    if (json)
+    {
+        fprintf(file, ",\"%s\":{\"mean\":%.3f", name, average(total, count));
+
+        for (int i = 0; i < NUMBER_OF_PERCENTILES; i++)
+        {
+            fprintf(file, ",\"%s\":%lld", PERCENTILE_NAMES[i], getPercentile(histogram, PERCENTILES[i]));
+        }
+
+        fprintf(file, ",\"max\":%lld}", histogram->max);
+
+        return;
+    }
+
+    fprintf(file, "%-16s mean %.3f", name, average(total, count));
+
+    for (int i = 0; i < NUMBER_OF_PERCENTILES; i++)
+    {
+        fprintf(file, ", %s %lld", PERCENTILE_NAMES[i], getPercentile(histogram, PERCENTILES[i]));
+    }
+
+    fprintf(file, ", max %lld\n", histogram->max);
+}
+
+void printSummary(FILE *file, Metrics_t *Metrics, int mode, int memory_scheme, int quantum, int aging_interval, bool json)
+{
+    //a run lasts until its last transition, ticks are milliseconds
+    double utilization = Metrics->end_tick > 0 ? (double)Metrics->busy_ticks / (double)Metrics->end_tick : 0.0;
+    double throughput = Metrics->end_tick > 0 ? 1000.0 * (double)Metrics->completed / (double)Metrics->end_tick : 0.0;
+
+    if (json)
+    {
+        fprintf(file, "{\"mode\":%d,\"memory_scheme\":%d,\"quantum\":%d,\"aging_interval\":%d,\"processes\":%lld,"
+                      "\"end_tick\":%lld,\"busy_ticks\":%lld,\"cpu_utilization\":%.6f,\"throughput_per_1000_ticks\":%.6f,"
+                      "\"dispatches\":%lld",
+                mode, memory_scheme, quantum, aging_interval, Metrics->completed, Metrics->end_tick, Metrics->busy_ticks,
+                utilization, throughput, Metrics->dispatches);
+    }
+    else
+    {
+        fprintf(file, "mode %d, memory scheme %d, quantum %d, aging interval %d\n", mode, memory_scheme, quantum, aging_interval);
+        fprintf(file, "processes:       %lld\n", Metrics->completed);
+        fprintf(file, "end tick:        %lld\n", Metrics->end_tick);
+        fprintf(file, "cpu utilization: %.2f%%\n", 100.0 * utilization);
+        fprintf(file, "throughput:      %.4f processes per 1000 ticks\n", throughput);
+        fprintf(file, "dispatches:      %lld\n", Metrics->dispatches);
+    }
+
+    printTime(file, json ? "turnaround" : "turnaround:", Metrics->total_turnaround, Metrics->completed, &Metrics->turnaround, json);
+    printTime(file, json ? "waiting" : "waiting:", Metrics->total_waiting, Metrics->completed, &Metrics->waiting, json);
+    printTime(file, json ? "response" : "response:", Metrics->total_response, Metrics->responded, &Metrics->response, json);
+
+    //the lateness is over the missed deadlines only
+    if (json)
+    {
+        fprintf(file, ",\"deadlines\":%lld,\"deadline_misses\":%lld", Metrics->deadlines, Metrics->deadline_misses);
+        printTime(file, "lateness", Metrics->total_lateness, Metrics->deadline_misses, &Metrics->lateness, json);
+        fprintf(file, "}\n");
+    }
+    else if (Metrics->deadlines > 0)
+    {
+        fprintf(file, "deadline misses: %lld of %lld (%.2f%%)\n", Metrics->deadline_misses, Metrics->deadlines,
+                100.0 * Metrics->deadline_misses / Metrics->deadlines);
+        printTime(file, "lateness:", Metrics->total_lateness, Metrics->deadline_misses, &Metrics->lateness, json);
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "process.h"
+#include "histogram.h"
+
+/* ======================================================
+ * SCHEDULING METRICS IMPLEMENTATION
+ * ======================================================
+ */
+
+//Scheduling metrics of a run, accumulated on every transition so no trace has to be written or read back.
+//The times of a process are measured from its arrival tick (tick 0 for processes arriving before it):
+//turnaround until it is TERMINATED, waiting as the ticks it spent READY, response until its first dispatch.
+//A process with a deadline misses it when it terminates after arrival + relative deadline, by its lateness.
+typedef struct Metrics
+{
+    long long transitions;      // Number of state transitions.
+    long long completed;        // Number of TERMINATED processes.
+    long long dispatches;       // Number of dispatches (READY to RUNNING transitions).
+    long long busy_ticks;       // Ticks a process spent RUNNING.
+    long long end_tick;         // Tick of the last transition.
+    long long total_turnaround; // Sum of the turnaround times of the TERMINATED processes.
+    long long total_waiting;    // Sum of the waiting times of the TERMINATED processes.
+    long long responded;        // Number of processes dispatched at least once.
+    long long total_response;   // Sum of the response times of the processes dispatched at least once.
+    long long deadlines;        // Number of TERMINATED processes that had a deadline.
+    long long deadline_misses;  // Number of them that terminated after their deadline.
+    long long total_lateness;   // Sum of the ticks the deadlines were missed by.
+    Histogram_t turnaround;     // Distributions of the turnaround, waiting and response times, for percentiles.
+    Histogram_t waiting;
+    Histogram_t response;
+    Histogram_t lateness;       // Distribution of the lateness of the missed deadlines.
+} Metrics_t;
+
+//Constructing and clean up functions for the metrics.
+Metrics_t *initMetrics();
+void cleanMetrics(Metrics_t *Metrics);
+
+//Command for accounting a transition, called with the process already in its new state.
+void recordTransition(Metrics_t *Metrics, process_t *process, States prevState, long long clock);
+
+//Prints the metrics of a run and its parameters as text, or as one line of JSON (with p50, p90, p99, p99.9 and max
+//of each time). The deadline misses are only printed as text when some processes had a deadline.
+void printSummary(FILE *file, Metrics_t *Metrics, int mode, int memory_scheme, int quantum, int aging_interval, bool json);
+
+#endif //METRICS_H
@@ -0,0 +1,46 @@
+#ifndef PROCESS_H
+#define PROCESS_H
+
+//The different possible states a process can have ("TERMINATED" is synonymous for EXIT)
+typedef enum Process_State
+{
+    NEW,       // Process is NEW
+    READY,     // Process is READY to run
+    RUNNING,   // Process is RUNNING
+    WAITING,   // Process is WAITING for I/O and such
+    TERMINATED // Process is finished its task and TERMINATED/EXIT
+} States;
+
+//The data structure for the PCB
+typedef struct process
+{
+    int pid;                               // Process ID.
+    int arrival_time;                      // Time of arrival.
+    int total_CPU_time;                    // Total execution time.
+    int current_CPU_time_needed;           // Amount of CPU time needed to finish the task.
+    int IO_frequency;                      // How frequently IO is accessed.
+    int current_time_until_IO;             // Amount of time until I/O is needed by the process.
+    int IO_duration;                       // How long IO is accessed.
+    int current_time_until_IO_is_finished; // Amount of time until I/O is needed by the process.
+    int initial_priority;                  // Priority when the process first came into the queue.
+    int effective_priority;                // Effective priority the process currently has.
+    int memory_needed;                     // The amount of memory need for the process.
+    int relative_deadline;                 // Ticks after its arrival the process has to terminate by, 0 if it has no deadline.
+    int partition_used;                    // The partition that the process is stored on, set to -1 is not in memory
+    long long aging_epoch;                 // Aging epoch of the priority queue when the process was enqueued on it.
+    int mlfq_level;                        // Level of the multilevel feedback queue the process is on (0 is the top).
+    long long mlfq_boosts;                 // Number of boosts of the multilevel feedback queue the level is up to date with.
+    long long vruntime;                    // Virtual runtime with the completely fair scheduler (weighted ticks run).
+    long long timer_expiry;                // Tick the process's timer on the timer wheel expires on (end of its I/O).
+    struct process *timer_next;            // Next process in the same slot of the timer wheel.
+    long long load_order;                  // Position of the process in the input file, transitions on a tick happen in this order.
+    long long state_entered;               // Tick the process entered its current state on.
+    long long ready_wait;                  // Ticks spent in the READY state so far.
+    int dispatches;                        // Number of times the process has been dispatched (READY to RUNNING).
+    int preemptions;                       // Number of times the process was preempted or timed out (RUNNING to READY).
+    long long first_run;                   // Tick of the first dispatch of the process.
+    long long io_wait;                     // Ticks spent in the WAITING state so far.
+    States state;                          // Current state of a process.
+} process_t;
+
+#endif //PROCESS_H
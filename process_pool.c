@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "process_pool.h"
+
+//Initializing an empty pool, the first block is allocated by the first allocateProcess.
+ProcessPool_t *initProcessPool()
+{
+    //Allocating memory for the pool on the heap.
+    ProcessPool_t *ProcessPool = (ProcessPool_t *)malloc(sizeof(ProcessPool_t));
+
+    ProcessPool->chunks = NULL;
+    ProcessPool->free_slots = NULL;
+    ProcessPool->live = 0;
+    ProcessPool->peak = 0;
+    ProcessPool->allocated = 0;
+
+    return ProcessPool;
+}
+
+//Method to clean up the pool (deallocates every block and the pool).
+//Parameter:- ProcessPool, a process pool.
+//Return:- N/A.
+void cleanProcessPool(ProcessPool_t *ProcessPool)
+{
+    ProcessChunk_t *chunk = ProcessPool->chunks;
+
+    while (chunk != NULL)
+    {
+        ProcessChunk_t *next = chunk->next;
+
+        free(chunk);
+        chunk = next;
+    }
+
+    free(ProcessPool);
+}
+
+//Function that takes a free slot from the pool, allocating a new block if none is free.
+//Parameter:- ProcessPool, a process pool.
+//Return:- a slot for a process, NULL if no block can be allocated.
+process_t *allocateProcess(ProcessPool_t *ProcessPool)
+{
+    //Allocating a new block and putting its slots on the free list when every slot is in use.
+    if (ProcessPool->free_slots == NULL)
+    {
+        ProcessChunk_t *chunk = (ProcessChunk_t *)malloc(sizeof(ProcessChunk_t));
+
+        if (chunk == NULL)
+        {
+            return NULL;
+        }
+
+        chunk->next = ProcessPool->chunks;
+        ProcessPool->chunks = chunk;
+        ProcessPool->allocated += PROCESS_POOL_CHUNK;
+
+        //the slots are linked in reverse so they are handed out in the order of the block
+        for (int i = PROCESS_POOL_CHUNK - 1; i >= 0; i--)
+        {
+            chunk->processes[i].timer_next = ProcessPool->free_slots;
+            ProcessPool->free_slots = &chunk->processes[i];
+        }
+    }
+
+    process_t *process = ProcessPool->free_slots;
+
+    ProcessPool->free_slots = process->timer_next;
+    process->timer_next = NULL;
+
+    ProcessPool->live++;
+
+    if (ProcessPool->live > ProcessPool->peak)
+    {
+        ProcessPool->peak = ProcessPool->live;
+    }
+
+    return process;
+}
+
+//Method that gives the slot of a process that is done back to the pool.
+//Parameter:- ProcessPool, a process pool.
+//Parameter:- process, a process taken from the pool, it can not be in any queue or on any timer.
+//Return:- N/A.
+void releaseProcess(ProcessPool_t *ProcessPool, process_t *process)
+{
+    process->timer_next = ProcessPool->free_slots;
+    ProcessPool->free_slots = process;
+
+    ProcessPool->live--;
+}
+
+//Function that returns the number of slots in use.
+int getLiveProcessCount(ProcessPool_t *ProcessPool)
+{
+    return ProcessPool->live;
+}
+
+//Function that returns the largest number of slots that have been in use at once.
+int getPeakProcessCount(ProcessPool_t *ProcessPool)
+{
+    return ProcessPool->peak;
+}
+
+//Function that returns the number of slots allocated.
+int getAllocatedProcessCount(ProcessPool_t *ProcessPool)
+{
+    return ProcessPool->allocated;
+}
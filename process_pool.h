@@ -0,0 +1,48 @@
+#ifndef PROCESS_POOL_H
+#define PROCESS_POOL_H
+
+#include "process.h"
+
+/* ======================================================
+ * PROCESS POOL IMPLEMENTATION
+ * ======================================================
+ */
+
+//Number of PCBs allocated at once when the pool runs out of free slots.
+#define PROCESS_POOL_CHUNK 256
+
+//A block of PCBs allocated together, the blocks of a pool are kept in a list so they can be freed.
+typedef struct ProcessChunk
+{
+    struct ProcessChunk *next;               // Next block of the pool.
+    process_t processes[PROCESS_POOL_CHUNK]; // PCBs of the block.
+} ProcessChunk_t;
+
+//Pool of PCB slots for streamed workloads.
+//Slots of TERMINATED processes are given back and recycled for the processes read after them, so the memory used
+//grows with the largest number of processes alive at once instead of with the length of the workload.
+//PCBs are allocated in blocks that never move, so pointers to a process stay valid while it is alive.
+//The free slots are linked through timer_next (a free slot has no timer).
+typedef struct ProcessPool
+{
+    ProcessChunk_t *chunks; // List of the allocated blocks.
+    process_t *free_slots;  // List of the slots not in use.
+    int live;               // Number of slots in use.
+    int peak;               // Largest number of slots in use at once.
+    int allocated;          // Number of slots allocated in all blocks.
+} ProcessPool_t;
+
+//Constructing and clean up functions for the pool.
+ProcessPool_t *initProcessPool();
+void cleanProcessPool(ProcessPool_t *ProcessPool);
+
+//Commands for taking a slot for a new process and giving back the slot of a TERMINATED process.
+process_t *allocateProcess(ProcessPool_t *ProcessPool);
+void releaseProcess(ProcessPool_t *ProcessPool, process_t *process);
+
+//Accessor methods for the number of slots in use, the peak and the number allocated.
+int getLiveProcessCount(ProcessPool_t *ProcessPool);
+int getPeakProcessCount(ProcessPool_t *ProcessPool);
+int getAllocatedProcessCount(ProcessPool_t *ProcessPool);
+
+#endif //PROCESS_POOL_H
@@ -0,0 +1,618 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+
+#include "queue.h"
+
+//Initializing the queue and setting its member's initial state.
+Queue_t *initReadyQueue()
+{
+
+    //Allocating memory for queue on the heap.
+    Queue_t *ReadyQueue = (Queue_t *)malloc(sizeof(Queue_t));
+
+    //Starting with room for a few processes, head at the start of the array and size to 0.
+    ReadyQueue->capacity = 16;
+    ReadyQueue->processes = (process_t **)malloc(sizeof(process_t *) * ReadyQueue->capacity);
+    ReadyQueue->head = 0;
+    ReadyQueue->size = 0;
+
+    //Returning the queue.
+    return ReadyQueue;
+}
+
+//Function that returns the process at a position in the queue (0 is the head).
+//Parameter:- ReadyQueue, a queue.
+//Parameter:- position, a position in the queue.
+//Return:- a pointer to the slot of the array holding that position.
+static process_t **queueSlot(Queue_t *ReadyQueue, int position)
+{
+    int index = ReadyQueue->head + position;
+
+    //wrapping around the end of the circular array
+    if (index >= ReadyQueue->capacity)
+    {
+        index -= ReadyQueue->capacity;
+    }
+
+    return &ReadyQueue->processes[index];
+}
+
+//Method that doubles the array of the queue when it is full, the queue is unwrapped so the head is at the start.
+//Parameter:- ReadyQueue, a queue.
+//Return:- N/A.
+static void growReadyQueue(Queue_t *ReadyQueue)
+{
+    if (ReadyQueue->size < ReadyQueue->capacity)
+    {
+        return;
+    }
+
+    process_t **processes = (process_t **)malloc(sizeof(process_t *) * ReadyQueue->capacity * 2);
+
+    for (int i = 0; i < ReadyQueue->size; i++)
+    {
+        processes[i] = *queueSlot(ReadyQueue, i);
+    }
+
+    free(ReadyQueue->processes);
+
+    ReadyQueue->processes = processes;
+    ReadyQueue->head = 0;
+    ReadyQueue->capacity *= 2;
+}
+
+//Function ages all processes in the priority queue.
+//Method to print out the queue as it stands.
+//Parameter:- ReadyQueue, a queue.
+//Return:- N/A.
+void print_queue(Queue_t *ReadyQueue){
+
+    //iterates through queue from the head and prints all elements with arrows pointing towards the tail
+    for (int i = 0; i < ReadyQueue->size; i++)
+    {
+        process_t *process = *queueSlot(ReadyQueue, i);
+
+        printf("%d (priority: %d) -> ", process->pid, process->effective_priority);
+    }
+
+    printf("\n");
+}
+
+//Method to clean up the queue (deallocates the memory on the heap of the queue).
+//Processes still on the queue belong to the caller and are not freed.
+//Parameter:- ReadyQueue, a queue.
+//Return:- N/A.
+void cleanReadyQueue(Queue_t *ReadyQueue)
+{
+    free(ReadyQueue->processes); //Freeing the array of the queue.
+    free(ReadyQueue); //Freeing the provided queue.
+}
+
+//Method for enqueue-ing a process onto the queue.
+//Parameter:- ReadyQueue, a queue.
+//Parameter:- process, a PCB to enqueue.
+//Return:- N/A.
+void enqueue(Queue_t *ReadyQueue, process_t *process)
+{
+    //Making room for one more process if the array is full.
+    growReadyQueue(ReadyQueue);
+
+    //Placing the process after the tail of the queue.
+    *queueSlot(ReadyQueue, ReadyQueue->size) = process;
+
+    //Incrementing the size of the queue.
+    ReadyQueue->size++;
+
+    //TESTING
+    //print_queue(ReadyQueue);
+}
+
+//Method for enqueue-ing a process onto the queue and placing it in the proper place according to priority.
+//The process is placed after processes with higher or the same priority but before processes with lower priority
+//(i.e., before the first process with a higher priority number).
+//Parameters:- ReadyQueue, a queue.
+//Parameter:- process, a PCB to enqueue.
+//Return:- N/A.
+void priority_enqueue(Queue_t *ReadyQueue, process_t *process)
+{
+    //Making room for one more process if the array is full.
+    growReadyQueue(ReadyQueue);
+
+    //Iterating through the processes in the priority queue comparing priorities until
+    //a process with a lower priority (i.e., a higher number) than the process being enqueued is found.
+    int position = 0;
+
+    while (position < ReadyQueue->size && (*queueSlot(ReadyQueue, position))->effective_priority <= process->effective_priority)
+    {
+        position++;
+    }
+
+    //Shifting the processes with lower priority one place towards the tail.
+    for (int i = ReadyQueue->size; i > position; i--)
+    {
+        *queueSlot(ReadyQueue, i) = *queueSlot(ReadyQueue, i - 1);
+    }
+
+    //Placing the process in the gap.
+    *queueSlot(ReadyQueue, position) = process;
+
+    //Incrementing the size of the queue.
+    ReadyQueue->size++;
+}
+
+//function ages all processes in the priority queue
+//parameters are: a queue
+//returns nothing
+void age_priority_queue(Queue_t *ReadyQueue)
+{
+
+    //iterate throughout the entire priority queue and decrement the effective priority to age the processes
+    for (int i = 0; i < ReadyQueue->size; i++)
+    {
+        process_t *process = *queueSlot(ReadyQueue, i);
+
+        //check if the effective priority is greater than 0 then decrement (to avoid negative numbers for priority)
+        if (process->effective_priority > 0)
+        {
+            process->effective_priority--;
+        }
+    }
+}
+
+
+//function dequeues a process off the queue
+//parameters are: a queue
+//returns a process struct
+process_t *dequeue(Queue_t *ReadyQueue)
+{
+
+    //assertion: the simulator only dequeues a queue that is not empty, so dequeuing an empty one is a bug and exits
+    if (ReadyQueue->size == 0)
+    {
+        perror("Error nothing is in the queue, Returning an empty process");
+        exit(-1);
+
+        
+    }
+
+    //gets the process at the head of the queue
+    process_t *frontProcess = *queueSlot(ReadyQueue, 0);
+
+    //moves the head to the next position, wrapping around the end of the array
+    ReadyQueue->head++;
+
+    if (ReadyQueue->head == ReadyQueue->capacity)
+    {
+        ReadyQueue->head = 0;
+    }
+
+    //decrements the size of the queue
+    ReadyQueue->size--;
+
+    //returns process that was at the front of the queue
+    return frontProcess;
+}
+
+//function that returns the size of the queue
+//parameters a pointer to a queue
+//returns the size of the queue inputted
+int getQueueSize(Queue_t *ReadyQueue)
+{
+    return ReadyQueue->size;
+}
+
+/* ======================================================
+ * PRIORITY HEAP IMPLEMENTATION
+ * ======================================================
+ */
+
+//Initializing the priority queue and setting its member's initial state.
+PriorityQueue_t *initPriorityQueue()
+{
+    //Allocating memory for the priority queue on the heap.
+    PriorityQueue_t *PriorityQueue = (PriorityQueue_t *)malloc(sizeof(PriorityQueue_t));
+
+    //Starting with room for a few entries, the array doubles when it is full.
+    PriorityQueue->capacity = 16;
+    PriorityQueue->nodes = (HeapNode_t *)malloc(sizeof(HeapNode_t) * PriorityQueue->capacity);
+    PriorityQueue->size = 0;
+    PriorityQueue->next_order = 0;
+    PriorityQueue->epoch = 0;
+
+    return PriorityQueue;
+}
+
+//Method to clean up the priority queue (deallocates the heap array and the queue).
+//Parameter:- PriorityQueue, a priority queue.
+//Return:- N/A.
+void cleanPriorityQueue(PriorityQueue_t *PriorityQueue)
+{
+    free(PriorityQueue->nodes);
+    free(PriorityQueue);
+}
+
+//Function that checks if entry a comes out of the priority queue before entry b.
+//Parameters:- a and b, two heap entries.
+//Return:- true if a has a lower rank, or the same rank and was enqueued first.
+static bool heapNodeBefore(HeapNode_t *a, HeapNode_t *b)
+{
+    if (a->rank != b->rank)
+    {
+        return a->rank < b->rank;
+    }
+
+    return a->order < b->order;
+}
+
+//Method that adds an entry to the heap.
+//Parameter:- PriorityQueue, a priority queue.
+//Parameter:- process, a PCB to enqueue.
+//Parameter:- rank, the rank of the entry.
+//Return:- N/A.
+static void heapPush(PriorityQueue_t *PriorityQueue, process_t *process, long long rank)
+{
+    //Doubling the array when it is full.
+    if (PriorityQueue->size == PriorityQueue->capacity)
+    {
+        PriorityQueue->capacity *= 2;
+        PriorityQueue->nodes = (HeapNode_t *)realloc(PriorityQueue->nodes, sizeof(HeapNode_t) * PriorityQueue->capacity);
+    }
+
+    HeapNode_t node = {process, rank, PriorityQueue->next_order++};
+
+    //Sifting the new entry up from the bottom of the heap until its parent comes before it.
+    int position = PriorityQueue->size++;
+
+    while (position > 0)
+    {
+        int parent = (position - 1) / 2;
+
+        if (!heapNodeBefore(&node, &PriorityQueue->nodes[parent]))
+        {
+            break;
+        }
+
+        PriorityQueue->nodes[position] = PriorityQueue->nodes[parent];
+        position = parent;
+    }
+
+    PriorityQueue->nodes[position] = node;
+}
+
+//Function that removes the entry at the top of the heap.
+//Parameter:- PriorityQueue, a priority queue.
+//Return:- the process of the removed entry.
+static process_t *heapPop(PriorityQueue_t *PriorityQueue)
+{
+    //assertion: the simulator only dequeues a queue that is not empty, so dequeuing an empty one is a bug and exits
+    if (PriorityQueue->size == 0)
+    {
+        perror("Error nothing is in the queue, Returning an empty process");
+        exit(-1);
+    }
+
+    process_t *frontProcess = PriorityQueue->nodes[0].process;
+
+    //Sifting the last entry down from the top of the heap until both children come after it.
+    HeapNode_t last = PriorityQueue->nodes[--PriorityQueue->size];
+    int position = 0;
+
+    while (true)
+    {
+        int child = 2 * position + 1;
+
+        if (child >= PriorityQueue->size)
+        {
+            break;
+        }
+
+        if (child + 1 < PriorityQueue->size && heapNodeBefore(&PriorityQueue->nodes[child + 1], &PriorityQueue->nodes[child]))
+        {
+            child++;
+        }
+
+        if (!heapNodeBefore(&PriorityQueue->nodes[child], &last))
+        {
+            break;
+        }
+
+        PriorityQueue->nodes[position] = PriorityQueue->nodes[child];
+        position = child;
+    }
+
+    PriorityQueue->nodes[position] = last;
+
+    return frontProcess;
+}
+
+//Rank added to a negative priority so it is below every rank a priority of 0 or more can have
+#define NEGATIVE_PRIORITY_TIER (LLONG_MIN / 2)
+
+//Method for enqueue-ing a process onto the priority queue in O(log n).
+//Parameter:- PriorityQueue, a priority queue.
+//Parameter:- process, a PCB to enqueue.
+//Return:- N/A.
+void priority_heap_enqueue(PriorityQueue_t *PriorityQueue, process_t *process)
+{
+    //Recording the aging epoch the process was enqueued at, its effective priority is derived from it.
+    process->aging_epoch = PriorityQueue->epoch;
+
+    //Ordering by priority plus epoch: a process enqueued later has been aged less, which is the same as
+    //every earlier process having its priority lowered by the agings in between.
+    long long rank = (long long)process->effective_priority + PriorityQueue->epoch;
+
+    //A negative priority is never aged, and aging never takes a priority below 0, so a process with a negative
+    //priority comes before every aged process whatever the epochs are: those processes get a tier of their own,
+    //ordered by their priority.
+    if (process->effective_priority < 0)
+    {
+        rank = (long long)process->effective_priority + NEGATIVE_PRIORITY_TIER;
+    }
+
+    heapPush(PriorityQueue, process, rank);
+}
+
+//Method for enqueue-ing a process onto the heap with a rank of its own in O(log n), the heap is then a plain
+//min-heap on the rank (shortest job first orders by the remaining CPU time). Aging is not used with it.
+//Parameter:- PriorityQueue, a priority queue.
+//Parameter:- process, a PCB to enqueue.
+//Parameter:- rank, the rank of the process, the lowest rank comes out first.
+//Return:- N/A.
+void keyed_heap_enqueue(PriorityQueue_t *PriorityQueue, process_t *process, long long rank)
+{
+    heapPush(PriorityQueue, process, rank);
+}
+
+//Function that dequeues the process with the highest priority off the priority queue in O(log n).
+//Parameter:- PriorityQueue, a priority queue.
+//Return:- a process struct.
+process_t *priority_heap_dequeue(PriorityQueue_t *PriorityQueue)
+{
+    process_t *frontProcess = heapPop(PriorityQueue);
+
+    //Applying the agings the process went through while it was queued.
+    frontProcess->effective_priority = getQueuedEffectivePriority(PriorityQueue, frontProcess);
+
+    return frontProcess;
+}
+
+//Function that dequeues the process with the lowest rank off a heap filled by keyed_heap_enqueue in O(log n).
+//Parameter:- PriorityQueue, a priority queue.
+//Return:- a process struct.
+process_t *keyed_heap_dequeue(PriorityQueue_t *PriorityQueue)
+{
+    return heapPop(PriorityQueue);
+}
+
+//function ages all processes in the priority queue a number of times in O(1) by advancing the aging epoch
+//The ranks are left alone, which keeps the heap ordered. They are not floored at 0 like the effective priority:
+//priority_enqueue keeps floored processes in the order they had before reaching 0, and the unfloored ranks keep
+//exactly that order.
+//parameters are: a priority queue and the number of times to age it
+//returns nothing
+void age_priority_heap(PriorityQueue_t *PriorityQueue, long long agings)
+{
+    PriorityQueue->epoch += agings;
+}
+
+//function that returns the size of the priority queue
+//parameters a pointer to a priority queue
+//returns the size of the priority queue inputted
+int getPriorityQueueSize(PriorityQueue_t *PriorityQueue)
+{
+    return PriorityQueue->size;
+}
+
+//function that returns the process at the head of the heap in O(1), without dequeue-ing it
+//(its effective priority is the one it had when it was enqueued, getQueuedEffectivePriority applies the agings)
+//parameters a pointer to a non-empty priority queue
+//returns the process that comes out next
+process_t *priority_heap_peek(PriorityQueue_t *PriorityQueue)
+{
+    return PriorityQueue->nodes[0].process;
+}
+
+//function that returns the rank of the process at the head of the heap in O(1), without dequeue-ing it
+//parameters a pointer to a non-empty priority queue
+//returns the lowest rank on the heap
+long long getHeapHeadRank(PriorityQueue_t *PriorityQueue)
+{
+    return PriorityQueue->nodes[0].rank;
+}
+
+//function that returns the aging epoch of the priority queue
+//parameters a pointer to a priority queue
+//returns the number of times the priority queue has been aged
+long long getAgingEpoch(PriorityQueue_t *PriorityQueue)
+{
+    return PriorityQueue->epoch;
+}
+
+//function that derives the current effective priority of a process on the priority queue
+//every aging since the process was enqueued lowers its priority by one, down to 0
+//(a priority that is already 0 or lower is never aged)
+//parameters a pointer to a priority queue and a process on it
+//returns the effective priority of the process
+int getQueuedEffectivePriority(PriorityQueue_t *PriorityQueue, process_t *process)
+{
+    long long aged = process->effective_priority - (PriorityQueue->epoch - process->aging_epoch);
+
+    if (process->effective_priority <= 0)
+    {
+        return process->effective_priority;
+    }
+
+    return aged > 0 ? (int)aged : 0;
+}
+
+//Initializing an empty multilevel feedback queue.
+//Parameter:- numberOfLevels, the number of levels (1 to MLFQ_MAX_LEVELS).
+//Return:- the multilevel feedback queue.
+MultilevelQueue_t *initMultilevelQueue(int numberOfLevels)
+{
+    //assertion: setSimulatorLevels fails on a number of levels that does not fit in the bitmap before it gets here,
+    //so this is a bug and exits
+    if (numberOfLevels < 1 || numberOfLevels > MLFQ_MAX_LEVELS)
+    {
+        fprintf(stderr, "a multilevel feedback queue has 1 to %d levels\n", MLFQ_MAX_LEVELS);
+        exit(-1);
+    }
+
+    //Allocating memory for the multilevel feedback queue on the heap.
+    MultilevelQueue_t *MultilevelQueue = (MultilevelQueue_t *)malloc(sizeof(MultilevelQueue_t));
+
+    for (int level = 0; level < MLFQ_MAX_LEVELS; level++)
+    {
+        MultilevelQueue->levels[level] = level < numberOfLevels ? initReadyQueue() : NULL;
+    }
+
+    MultilevelQueue->bitmap = 0;
+    MultilevelQueue->numberOfLevels = numberOfLevels;
+    MultilevelQueue->size = 0;
+    MultilevelQueue->boosts = 0;
+
+    return MultilevelQueue;
+}
+
+//Method to clean up the multilevel feedback queue (deallocates the queue of every level and the multilevel queue).
+//Parameter:- MultilevelQueue, a multilevel feedback queue.
+//Return:- N/A.
+void cleanMultilevelQueue(MultilevelQueue_t *MultilevelQueue)
+{
+    for (int level = 0; level < MultilevelQueue->numberOfLevels; level++)
+    {
+        cleanReadyQueue(MultilevelQueue->levels[level]);
+    }
+
+    free(MultilevelQueue);
+}
+
+//Method for enqueue-ing a process at the tail of its level.
+//A process that has not been enqueued since the last boost goes back to level 0.
+//Parameter:- MultilevelQueue, a multilevel feedback queue.
+//Parameter:- process, a PCB to enqueue, its mlfq_level is the level it goes on.
+//Return:- N/A.
+void mlfq_enqueue(MultilevelQueue_t *MultilevelQueue, process_t *process)
+{
+    process->mlfq_level = getProcessLevel(MultilevelQueue, process);
+    process->mlfq_boosts = MultilevelQueue->boosts;
+
+    enqueue(MultilevelQueue->levels[process->mlfq_level], process);
+
+    //Marking the level as not empty.
+    MultilevelQueue->bitmap |= 1ull << process->mlfq_level;
+    MultilevelQueue->size++;
+}
+
+//Function that dequeues the process at the head of the highest non-empty level in O(1).
+//Parameter:- MultilevelQueue, a multilevel feedback queue.
+//Return:- a process struct.
+process_t *mlfq_dequeue(MultilevelQueue_t *MultilevelQueue)
+{
+    //assertion: the simulator only dequeues a queue that is not empty, so dequeuing an empty one is a bug and exits
+    if (MultilevelQueue->size == 0)
+    {
+        perror("Error nothing is in the queue, Returning an empty process");
+        exit(-1);
+    }
+
+    int level = getTopLevel(MultilevelQueue);
+    Queue_t *queue = MultilevelQueue->levels[level];
+
+    process_t *frontProcess = dequeue(queue);
+
+    //Marking the level as empty once its last process leaves.
+    if (getQueueSize(queue) == 0)
+    {
+        MultilevelQueue->bitmap &= ~(1ull << level);
+    }
+
+    MultilevelQueue->size--;
+
+    return frontProcess;
+}
+
+//Method that moves every process back to level 0, the queued ones after the processes already on level 0 in the
+//order of their levels, the others (running or waiting) the next time they are enqueued.
+//Boosting more than once in a row is the same as boosting once, so the boosts of skipped ticks are caught up at once.
+//Parameter:- MultilevelQueue, a multilevel feedback queue.
+//Parameter:- boosts, the number of boosts up to now (the queue is only boosted if it is more than before).
+//Return:- N/A.
+void mlfq_boost(MultilevelQueue_t *MultilevelQueue, long long boosts)
+{
+    if (boosts <= MultilevelQueue->boosts)
+    {
+        return;
+    }
+
+    MultilevelQueue->boosts = boosts;
+
+    Queue_t *top = MultilevelQueue->levels[0];
+
+    //Only the non-empty levels below the top are visited.
+    unsigned long long lower = MultilevelQueue->bitmap & ~1ull;
+
+    while (lower != 0)
+    {
+        int level = __builtin_ctzll(lower);
+        Queue_t *queue = MultilevelQueue->levels[level];
+
+        while (getQueueSize(queue) > 0)
+        {
+            enqueue(top, dequeue(queue));
+        }
+
+        lower &= lower - 1;
+    }
+
+    //The processes already on level 0 are up to date as well.
+    for (int i = 0; i < top->size; i++)
+    {
+        process_t *process = *queueSlot(top, i);
+
+        process->mlfq_level = 0;
+        process->mlfq_boosts = boosts;
+    }
+
+    MultilevelQueue->bitmap = MultilevelQueue->size > 0 ? 1ull : 0;
+}
+
+//function that returns the number of processes on the multilevel feedback queue
+//parameters a pointer to a multilevel feedback queue
+//returns the size of the multilevel feedback queue inputted
+int getMultilevelQueueSize(MultilevelQueue_t *MultilevelQueue)
+{
+    return MultilevelQueue->size;
+}
+
+//function that finds the highest non-empty level with a find-first-set on the bitmap
+//parameters a pointer to a multilevel feedback queue
+//returns the highest non-empty level, -1 if the queue is empty
+int getTopLevel(MultilevelQueue_t *MultilevelQueue)
+{
+    if (MultilevelQueue->bitmap == 0)
+    {
+        return -1;
+    }
+
+    return __builtin_ctzll(MultilevelQueue->bitmap);
+}
+
+//function that returns the current level of a process, which is level 0 if it has been boosted since its level was set
+//parameters a pointer to a multilevel feedback queue and a process
+//returns the level of the process
+int getProcessLevel(MultilevelQueue_t *MultilevelQueue, process_t *process)
+{
+    return process->mlfq_boosts == MultilevelQueue->boosts ? process->mlfq_level : 0;
+}
+
+//function that returns the number of boosts of the multilevel feedback queue
+//parameters a pointer to a multilevel feedback queue
+//returns the number of times the queue has been boosted
+long long getBoostEpoch(MultilevelQueue_t *MultilevelQueue)
+{
+    return MultilevelQueue->boosts;
+}
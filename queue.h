@@ -0,0 +1,113 @@
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include "process.h"
+
+/* ======================================================
+ * QUEUE IMPLEMENTATION
+ * ======================================================
+ */
+
+//Queue implementation with a growable circular array of PCB pointers.
+//The array only grows (doubling) when it is full, so enqueue-ing and dequeue-ing never allocate memory once
+//the queue has reached its largest size.
+typedef struct Queue
+{
+    process_t **processes; // Circular array of pointers to the queued PCBs.
+    int head;              // Position of the head of the queue in the array.
+    int size;              // Size of the queue.
+    int capacity;          // Number of processes the array can hold before growing.
+} Queue_t;
+
+//Constructing function for queue.
+Queue_t *initReadyQueue();
+
+//Clean up function for queue.
+void cleanReadyQueue(Queue_t *ReadyQueue);
+
+//Commands for enqueue-ing, dequeue-ing, and accessor method for queue size.
+void enqueue(Queue_t *ReadyQueue, process_t *process);
+process_t *dequeue(Queue_t *ReadyQueue);
+int getQueueSize(Queue_t *ReadyQueue);
+
+//Commands for enqueue-ing with priority scheduler algorithm.
+//To prevent starvation aging has been recognised.
+void priority_enqueue(Queue_t *ReadyQueue, process_t *process);
+void age_priority_queue(Queue_t *ReadyQueue);
+
+//An entry of the priority heap.
+typedef struct HeapNode
+{
+    process_t *process;       // Pointer to the entry's PCB (named process).
+    long long rank;           // Effective priority at enqueue plus the aging epoch at enqueue (a negative priority
+                              // plus LLONG_MIN / 2 instead, it is never aged), fixed while queued.
+    unsigned long long order; // Sequence number of the enqueue, keeps processes with the same rank first come first served.
+} HeapNode_t;
+
+//Priority queue implementation with a binary min-heap stored in an array.
+//Processes come out in the same order as with priority_enqueue: lowest priority number first and
+//first come first served among equal priorities.
+//Aging is lazy: the queue counts how many times it has been aged (its aging epoch) and a queued process's
+//effective priority is derived from the epoch it was enqueued at, so aging is O(1) and never reorders the heap.
+typedef struct PriorityQueue
+{
+    HeapNode_t *nodes;             // Array holding the heap.
+    int size;                      // Size of the queue.
+    int capacity;                  // Number of entries the array can hold before growing.
+    unsigned long long next_order; // Sequence number given to the next enqueued process.
+    long long epoch;               // Number of times the queue has been aged.
+} PriorityQueue_t;
+
+//Constructing and clean up functions for the priority queue.
+PriorityQueue_t *initPriorityQueue();
+void cleanPriorityQueue(PriorityQueue_t *PriorityQueue);
+
+//Commands for enqueue-ing, dequeue-ing, peeking at the head, aging, and accessor method for the priority queue size.
+void priority_heap_enqueue(PriorityQueue_t *PriorityQueue, process_t *process);
+process_t *priority_heap_dequeue(PriorityQueue_t *PriorityQueue);
+process_t *priority_heap_peek(PriorityQueue_t *PriorityQueue);
+void age_priority_heap(PriorityQueue_t *PriorityQueue, long long agings);
+int getPriorityQueueSize(PriorityQueue_t *PriorityQueue);
+
+//Commands for using the heap as a plain min-heap on a rank given with each process, and accessor method for the
+//rank at the head of the heap.
+void keyed_heap_enqueue(PriorityQueue_t *PriorityQueue, process_t *process, long long rank);
+process_t *keyed_heap_dequeue(PriorityQueue_t *PriorityQueue);
+long long getHeapHeadRank(PriorityQueue_t *PriorityQueue);
+
+//Accessor methods for the aging epoch and for the current effective priority of a queued process.
+long long getAgingEpoch(PriorityQueue_t *PriorityQueue);
+int getQueuedEffectivePriority(PriorityQueue_t *PriorityQueue, process_t *process);
+
+//Most levels a multilevel feedback queue can have (one bit of the bitmap per level).
+#define MLFQ_MAX_LEVELS 64
+
+//Multilevel feedback queue implementation with one first come first served queue per level, level 0 first.
+//A bitmap has the bit of every non-empty level set, so the highest non-empty level is found with a single
+//find-first-set in O(1) however many levels and processes there are (like the Linux O(1) scheduler's runqueues).
+//Boosts are lazy for the processes that are not queued: the queue counts its boosts and a process whose level was
+//set before the last boost is back on level 0 the next time it is enqueued.
+typedef struct MultilevelQueue
+{
+    Queue_t *levels[MLFQ_MAX_LEVELS]; // First come first served queue of every level.
+    unsigned long long bitmap;        // Bit i is set when level i is not empty.
+    int numberOfLevels;               // Number of levels.
+    int size;                         // Number of processes on all the levels.
+    long long boosts;                 // Number of times every process has been moved back to level 0.
+} MultilevelQueue_t;
+
+//Constructing and clean up functions for the multilevel feedback queue.
+MultilevelQueue_t *initMultilevelQueue(int numberOfLevels);
+void cleanMultilevelQueue(MultilevelQueue_t *MultilevelQueue);
+
+//Commands for enqueue-ing a process on its level, dequeue-ing from the highest non-empty level, boosting,
+//and accessor methods for the size, the highest non-empty level and the level of a process.
+void mlfq_enqueue(MultilevelQueue_t *MultilevelQueue, process_t *process);
+process_t *mlfq_dequeue(MultilevelQueue_t *MultilevelQueue);
+void mlfq_boost(MultilevelQueue_t *MultilevelQueue, long long boosts);
+int getMultilevelQueueSize(MultilevelQueue_t *MultilevelQueue);
+int getTopLevel(MultilevelQueue_t *MultilevelQueue);
+int getProcessLevel(MultilevelQueue_t *MultilevelQueue, process_t *process);
+long long getBoostEpoch(MultilevelQueue_t *MultilevelQueue);
+
+#endif //QUEUE_H
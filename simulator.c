@@ -0,0 +1,2195 @@
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <limits.h>
+
+#include "simulator.h"
+#include "queue.h"
+#include "fair_queue.h"
+#include "timer_wheel.h"
+#include "loader.h"
+#include "process_pool.h"
+#include "accounting.h"
+#include "memory_schemes.h"
+#include "memory_manager.h"
+#include "stats.h"
+
+/* ======================================================
+ * EVENT QUEUE IMPLEMENTATION
+ * ======================================================
+ */
+
+//The different kinds of events the event engine schedules
+typedef enum Event_Type
+{
+    ARRIVAL,   // Process reaches its arrival time
+    BURST_END  // Running process finishes its CPU burst (finishes its task, requests I/O or times out)
+} Event_Types;
+
+//An event for the event queue.
+typedef struct Event
+{
+    long long time;     // Tick the event happens on.
+    process_t *process; // Process the event happens to.
+    Event_Types type;   // Kind of event.
+    long long burst;    // Number of the CPU burst a BURST_END ends (a preempted burst's BURST_END is stale).
+} Event_t;
+
+//Event queue implementation with a binary min-heap ordered by time, then by the load order of the processes.
+//Events happening on the same tick come out in the same order the tick loop visits the processes.
+typedef struct EventQueue
+{
+    Event_t *events; // Array holding the heap.
+    int size;        // Number of events in the queue.
+    int capacity;    // Number of events the array can hold before growing.
+} EventQueue_t;
+
+//Constructing and clean up functions for the event queue.
+static EventQueue_t *initEventQueue(int capacity);
+static void cleanEventQueue(EventQueue_t *EventQueue);
+
+//Commands for pushing, popping and peeking at the earliest event.
+static void pushEvent(EventQueue_t *EventQueue, long long time, process_t *process, Event_Types type, long long burst);
+static Event_t popEvent(EventQueue_t *EventQueue);
+static Event_t *peekEvent(EventQueue_t *EventQueue, long long burst);
+
+//Initializing the event queue with room for capacity events.
+static EventQueue_t *initEventQueue(int capacity)
+{
+    //Allocating memory for the event queue on the heap.
+    EventQueue_t *EventQueue = (EventQueue_t *)malloc(sizeof(EventQueue_t));
+
+    //Always keeping room for at least one event.
+    if (capacity < 1)
+    {
+        capacity = 1;
+    }
+
+    EventQueue->events = (Event_t *)malloc(sizeof(Event_t) * capacity);
+    EventQueue->size = 0;
+    EventQueue->capacity = capacity;
+
+    return EventQueue;
+}
+
+//Method to clean up the event queue (deallocates the heap array and the queue).
+//Parameter:- EventQueue, an event queue.
+//Return:- N/A.
+static void cleanEventQueue(EventQueue_t *EventQueue)
+{
+    free(EventQueue->events);
+    free(EventQueue);
+}
+
+//Function that checks if event a comes before event b.
+//Parameters:- a and b, two events.
+//Return:- true if a happens first (earlier tick, or same tick and process loaded before).
+static bool eventBefore(Event_t *a, Event_t *b)
+{
+    if (a->time != b->time)
+    {
+        return a->time < b->time;
+    }
+
+    return a->process->load_order < b->process->load_order;
+}
+
+//Method for pushing an event onto the event queue.
+//Parameter:- EventQueue, an event queue.
+//Parameter:- time, the tick the event happens on.
+//Parameter:- process, the process the event happens to.
+//Parameter:- type, the kind of event.
+//Parameter:- burst, the number of the CPU burst a BURST_END ends (0 for an ARRIVAL).
+//Return:- N/A.
+static void pushEvent(EventQueue_t *EventQueue, long long time, process_t *process, Event_Types type, long long burst)
+{
+    //Doubling the array when it is full.
+    if (EventQueue->size == EventQueue->capacity)
+    {
+        EventQueue->capacity *= 2;
+        EventQueue->events = (Event_t *)realloc(EventQueue->events, sizeof(Event_t) * EventQueue->capacity);
+    }
+
+    Event_t event = {time, process, type, burst};
+
+    //Sifting the new event up from the bottom of the heap until its parent comes before it.
+    int position = EventQueue->size++;
+
+    while (position > 0)
+    {
+        int parent = (position - 1) / 2;
+
+        if (!eventBefore(&event, &EventQueue->events[parent]))
+        {
+            break;
+        }
+
+        EventQueue->events[position] = EventQueue->events[parent];
+        position = parent;
+    }
+
+    EventQueue->events[position] = event;
+}
+
+//Function that pops the earliest event off the event queue.
+//Parameter:- EventQueue, an event queue.
+//Return:- the earliest event.
+static Event_t popEvent(EventQueue_t *EventQueue)
+{
+    //assertion: the engine only pops an event it has peeked, so popping an empty event queue is a bug and exits
+    if (EventQueue->size == 0)
+    {
+        perror("Error nothing is in the event queue");
+        exit(-1);
+    }
+
+    Event_t earliest = EventQueue->events[0];
+
+    //Sifting the last event down from the top of the heap until both children come after it.
+    Event_t last = EventQueue->events[--EventQueue->size];
+    int position = 0;
+
+    while (true)
+    {
+        int child = 2 * position + 1;
+
+        if (child >= EventQueue->size)
+        {
+            break;
+        }
+
+        if (child + 1 < EventQueue->size && eventBefore(&EventQueue->events[child + 1], &EventQueue->events[child]))
+        {
+            child++;
+        }
+
+        if (!eventBefore(&EventQueue->events[child], &last))
+        {
+            break;
+        }
+
+        EventQueue->events[position] = EventQueue->events[child];
+        position = child;
+    }
+
+    EventQueue->events[position] = last;
+
+    return earliest;
+}
+
+//Function that returns the earliest event without removing it.
+//The BURST_END events of preempted bursts are dropped when they reach the top instead of being searched for in the
+//heap when the burst is preempted.
+//Parameter:- EventQueue, an event queue.
+//Parameter:- burst, the number of the CPU burst of the running process (the only BURST_END that is not stale).
+//Return:- a pointer to the earliest event, NULL if the event queue is empty.
+static Event_t *peekEvent(EventQueue_t *EventQueue, long long burst)
+{
+    while (EventQueue->size > 0 && EventQueue->events[0].type == BURST_END && EventQueue->events[0].burst != burst)
+    {
+        popEvent(EventQueue);
+    }
+
+    if (EventQueue->size == 0)
+    {
+        return NULL;
+    }
+
+    return &EventQueue->events[0];
+}
+
+/* ======================================================
+ * MEMORY-BLOCKED LIST IMPLEMENTATION
+ * ======================================================
+ */
+
+//List of the arrived processes that had no space in memory, sorted by load order.
+//A blocked process can only get a partition after one has been freed, since admissions only take space, so instead
+//of retrying every blocked process on every tick the list remembers how many frees had happened when each process
+//last tried (attempt) and a process only retries once a partition has been freed after that.
+//The tick loop retried the blocked processes on every tick in load order, so a free lets the processes after the
+//freed one retry on the same tick and the ones before it on the next tick.
+typedef struct BlockedList
+{
+    process_t **processes; // Blocked processes, sorted by load order.
+    long long *attempt;    // Number of frees that had happened when each process last tried to get a partition.
+    int size;              // Number of blocked processes.
+    int capacity;          // Number of processes the arrays can hold before growing.
+    long long frees;       // Number of partitions freed so far.
+    long long last_free;   // Tick of the last free.
+} BlockedList_t;
+
+//Constructing and clean up functions for the blocked list.
+static BlockedList_t *initBlockedList();
+static void cleanBlockedList(BlockedList_t *BlockedList);
+
+//Commands for blocking a process, unblocking or keeping a blocked process after it retried, and recording a free.
+static void blockProcess(BlockedList_t *BlockedList, process_t *process, int *next);
+static void unblockProcess(BlockedList_t *BlockedList, int position);
+static void keepBlocked(BlockedList_t *BlockedList, int *next);
+static int recordFree(BlockedList_t *BlockedList, long long clock, long long order);
+
+//Accessor methods for checking if the blocked processes retry on a tick, and if a blocked process can get a
+//partition since its last try.
+static bool blockedRetryOnTick(BlockedList_t *BlockedList, long long clock);
+static bool canRetryBlocked(BlockedList_t *BlockedList, int position);
+
+//Initializing an empty blocked list.
+static BlockedList_t *initBlockedList()
+{
+    //Allocating memory for the blocked list on the heap.
+    BlockedList_t *BlockedList = (BlockedList_t *)malloc(sizeof(BlockedList_t));
+
+    BlockedList->capacity = 16;
+    BlockedList->processes = (process_t **)malloc(sizeof(process_t *) * BlockedList->capacity);
+    BlockedList->attempt = (long long *)malloc(sizeof(long long) * BlockedList->capacity);
+    BlockedList->size = 0;
+    BlockedList->frees = 0;
+    BlockedList->last_free = -2;
+
+    return BlockedList;
+}
+
+//Method to clean up the blocked list (deallocates the arrays and the list).
+//Parameter:- BlockedList, a blocked list.
+//Return:- N/A.
+static void cleanBlockedList(BlockedList_t *BlockedList)
+{
+    free(BlockedList->processes);
+    free(BlockedList->attempt);
+    free(BlockedList);
+}
+
+//Function that returns the position of the first blocked process loaded after a given load order.
+//Parameter:- BlockedList, a blocked list.
+//Parameter:- order, the load order to search after.
+//Return:- the index into the blocked processes.
+static int firstBlockedAfter(BlockedList_t *BlockedList, long long order)
+{
+    int low = 0;
+    int high = BlockedList->size;
+
+    //binary search for the first blocked process with a greater load order
+    while (low < high)
+    {
+        int middle = (low + high) / 2;
+
+        if (BlockedList->processes[middle]->load_order <= order)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+//Method that adds a process that had no space in memory to the blocked list, keeping it sorted.
+//Parameter:- BlockedList, a blocked list.
+//Parameter:- process, the process that could not get a partition.
+//Parameter:- next, index of the next blocked process to visit on this tick, moved if the process goes before it.
+//Return:- N/A.
+static void blockProcess(BlockedList_t *BlockedList, process_t *process, int *next)
+{
+    //Doubling the arrays when they are full.
+    if (BlockedList->size == BlockedList->capacity)
+    {
+        BlockedList->capacity *= 2;
+        BlockedList->processes = (process_t **)realloc(BlockedList->processes, sizeof(process_t *) * BlockedList->capacity);
+        BlockedList->attempt = (long long *)realloc(BlockedList->attempt, sizeof(long long) * BlockedList->capacity);
+    }
+
+    int position = firstBlockedAfter(BlockedList, process->load_order);
+    int after = BlockedList->size - position;
+
+    memmove(&BlockedList->processes[position + 1], &BlockedList->processes[position], sizeof(process_t *) * after);
+    memmove(&BlockedList->attempt[position + 1], &BlockedList->attempt[position], sizeof(long long) * after);
+
+    BlockedList->processes[position] = process;
+    BlockedList->attempt[position] = BlockedList->frees;
+    BlockedList->size++;
+
+    //the process is behind the ones still to be visited on this tick
+    if (position < *next)
+    {
+        (*next)++;
+    }
+}
+
+//Function that checks if a blocked process can get a partition, which is only possible if one was freed since its
+//last try.
+//Parameter:- BlockedList, a blocked list.
+//Parameter:- position, index of the blocked process.
+//Return:- true if the process should try to get a partition.
+static bool canRetryBlocked(BlockedList_t *BlockedList, int position)
+{
+    return BlockedList->attempt[position] != BlockedList->frees;
+}
+
+//Method that removes a blocked process that got a partition from the list.
+//Parameter:- BlockedList, a blocked list.
+//Parameter:- position, index of the blocked process.
+//Return:- N/A.
+static void unblockProcess(BlockedList_t *BlockedList, int position)
+{
+    int after = BlockedList->size - position - 1;
+
+    memmove(&BlockedList->processes[position], &BlockedList->processes[position + 1], sizeof(process_t *) * after);
+    memmove(&BlockedList->attempt[position], &BlockedList->attempt[position + 1], sizeof(long long) * after);
+    BlockedList->size--;
+}
+
+//Method that keeps a blocked process that still has no partition in the list, and moves on to the next one.
+//Parameter:- BlockedList, a blocked list.
+//Parameter:- next, index of the blocked process, moved past it.
+//Return:- N/A.
+static void keepBlocked(BlockedList_t *BlockedList, int *next)
+{
+    BlockedList->attempt[*next] = BlockedList->frees;
+    (*next)++;
+}
+
+//Function that records that a partition was freed by a process on a tick.
+//Parameter:- BlockedList, a blocked list.
+//Parameter:- clock, the tick of the free.
+//Parameter:- order, the load order of the process that freed the partition.
+//Return:- the index of the first blocked process after it, the ones from there on retry on this tick.
+static int recordFree(BlockedList_t *BlockedList, long long clock, long long order)
+{
+    BlockedList->frees++;
+    BlockedList->last_free = clock;
+
+    return firstBlockedAfter(BlockedList, order);
+}
+
+//Function that checks if the blocked processes retry on a tick (a partition was freed on the tick before it,
+//the ones after the freed process in load order have already retried on the tick of the free).
+//Parameter:- BlockedList, a blocked list.
+//Parameter:- clock, the tick.
+//Return:- true if the blocked processes retry.
+static bool blockedRetryOnTick(BlockedList_t *BlockedList, long long clock)
+{
+    return BlockedList->size > 0 && BlockedList->last_free == clock - 1;
+}
+
+
+/* ========================================================
+ * KERNEL SIMULATOR IMPLEMENTATION
+ * =======================================================
+ */
+
+//The state of a simulation, shared by both engines
+struct Simulator
+{
+    process_t *processes;          // Array of processes read from the input file, NULL when the input is streamed.
+    long long numberOfProcesses;   // Number of processes loaded (so far when the input is streamed).
+    ProcessStream_t *stream;       // Streamed input file the processes are read from just before they arrive, or NULL.
+    ProcessPool_t *pool;           // Slots the streamed processes are kept in, recycled once they terminate.
+    const int *arrivalOrder;       // Positions of the processes sorted by arrival time, NULL when the input is streamed.
+    bool sharedArrivalOrder;       // arrivalOrder belongs to the caller and is shared with other simulations (not freed).
+    long long arrived;             // Number of processes that have arrived so far (the cursor into arrivalOrder).
+    int mode;                      // 1 FCFS, 2 Priority Scheduling, 3 Round Robin, 4 MLFQ, 5 CFS, 6 SJF, 7 SRTF,
+                                   // 8 preemptive Priority Scheduling, 9 EDF.
+    int memory_scheme;             // Memory scheme in use, 0 if unused.
+    int quantum;                   // Ticks a process runs for before it times out in the Round Robin algorithm.
+    int aging_interval;            // Ticks between agings of the priority queue.
+    int partitions[4][2];          // Remaining space and availability of every partition.
+    Queue_t *ReadyQueue;           // Ready queue keeping track of the order of processes.
+    PriorityQueue_t *PriorityQueue; // Ready queue used instead by the priority schedulers, SJF, SRTF and EDF.
+    MultilevelQueue_t *Levels;     // Ready queue used instead by the multilevel feedback queue, NULL with other modes.
+    int levelQuanta[MLFQ_MAX_LEVELS]; // Ticks a process runs for on each level before it is demoted.
+    int boost_interval;            // Ticks between boosts of every process back to the top level of the MLFQ.
+    FairQueue_t *Fair;             // Ready queue used instead by the completely fair scheduler, NULL with other modes.
+    int target_latency;            // Ticks in which every ready process runs once with CFS (while there are few).
+    int min_granularity;           // Shortest time slice with CFS.
+    TimerWheel_t *IOTimers;        // Timers of the WAITING processes, each expires on the tick its I/O is done.
+    BlockedList_t *blocked;        // Arrived processes that had no space in memory.
+    Trace_t *output;               // Output file the transitions are printed to.
+    Metrics_t *metrics;            // Scheduling metrics, accumulated on every transition.
+    Accounting_t *accounting;      // Accounting file every TERMINATED process gets a row in, or NULL.
+    long long clock;               // Clock in ticks.
+    process_t *RunningProcess;     // Process in the RUNNING state, NULL if there is none.
+    int timeout;                   // Ticks the running process has run for in its time slice (Round Robin and MLFQ).
+    int slice;                     // Length of the time slice of the running process (Round Robin and MLFQ).
+    long long stateCounts[5];      // Number of processes in each state, indexed by the States enum.
+    process_t **finishedIO;        // Processes that are done with IO on the current tick.
+    int finishedCapacity;          // Number of processes the finishedIO array can hold before growing.
+    process_t **arrivals;          // Processes arriving on the current tick.
+    int arrivalsCapacity;          // Number of processes the arrivals array can hold before growing.
+    bool loaded;                   // The processes have been loaded (or a stream opened).
+    bool failed;                   // The simulation can not go on (see error).
+    char error[LOADER_ERROR_SIZE]; // Description of why the simulation failed.
+#ifdef SCHEDULER_STATS
+    Stats_t stats;                 // Counts and times of the phases of the main loop (--stats).
+#endif
+};
+
+// function for printing details of the process (for debugging)
+void print_process_details(process_t process);
+
+//steps shared by both engines, each performs the same transitions the tick loop always has
+static void changeState(Simulator_t *sim, process_t *process, States newState);
+static int readyQueueSize(Simulator_t *sim);
+static void agingStep(Simulator_t *sim);
+static bool usesTimeSlices(Simulator_t *sim);
+static bool outranksRunning(Simulator_t *sim);
+static process_t *dispatchProcess(Simulator_t *sim);
+static void readyProcess(Simulator_t *sim, process_t *process);
+static void timeoutProcess(Simulator_t *sim, process_t *process);
+static bool admitProcess(Simulator_t *sim, process_t *process);
+static void terminateProcess(Simulator_t *sim, process_t *process);
+static void waitForIO(Simulator_t *sim, process_t *process);
+static void finishIO(Simulator_t *sim, process_t *process);
+static int collectFinishedIO(Simulator_t *sim);
+static process_t *nextArrival(Simulator_t *sim);
+static long long nextArrivalTime(Simulator_t *sim);
+
+//the two engines for running a simulation until all processes are terminated
+static void runTickEngine(Simulator_t *sim);
+static void runEventEngine(Simulator_t *sim);
+
+//Method that marks a simulation as failed, it stops running and the error is kept for getSimulatorError
+//only the first error is kept, the later ones are caused by it
+//parameters are: the simulation and a printf format describing the error with its arguments
+//returns false (so a failing function can return it directly)
+static bool failSimulator(Simulator_t *sim, const char *format, ...)
+{
+    if (!sim->failed)
+    {
+        va_list arguments;
+
+        va_start(arguments, format);
+        vsnprintf(sim->error, sizeof(sim->error), format, arguments);
+        va_end(arguments);
+
+        sim->failed = true;
+    }
+
+    return false;
+}
+
+//Function to create a simulation before its processes are loaded
+//parameters are: the scheduling algorithm, the memory scheme, the Round Robin quantum and the number of ticks
+//between agings
+//returns the simulation, or NULL for an unknown mode or memory scheme, or if the quantum or the aging interval is
+//below 1 tick
+Simulator_t *createSimulator(int mode, int memory_scheme, int quantum, int aging_interval)
+{
+    if (mode < 1 || mode > LAST_MODE || memory_scheme < 0 || memory_scheme > LAST_MEMORY_SCHEME)
+    {
+        return NULL;
+    }
+
+    //a process has to run for at least a tick before it times out, and aging can happen at most every tick
+    if (quantum < 1 || aging_interval < 1)
+    {
+        return NULL;
+    }
+
+    //Allocating memory for the simulation on the heap.
+    Simulator_t *sim = (Simulator_t *)malloc(sizeof(Simulator_t));
+
+    sim->mode = mode;
+    sim->memory_scheme = memory_scheme;
+    sim->quantum = quantum;
+    sim->aging_interval = aging_interval;
+
+    //double for loop to initial the partitions array to the correct sizes
+    memset(sim->partitions, 0, sizeof(sim->partitions));
+
+    if(memory_scheme == 1 || memory_scheme == 2 ){
+
+        for(int j = 0; j < 4; j++){
+
+            for(int k = 0; k < 2; k++){
+
+                if (memory_scheme == 1)
+                {
+                    sim->partitions[j][k] = MEMORY_SCHEME_1[j][k];
+                }
+                else
+                {
+                    sim->partitions[j][k]  = MEMORY_SCHEME_2[j][k];
+                }
+            }
+        }
+    }
+
+    //initializes the ready queue for keeping track of the order of processes
+    sim->ReadyQueue = initReadyQueue();
+    sim->PriorityQueue = initPriorityQueue();
+
+    //the multilevel feedback queue starts with MLFQ_LEVELS levels, the quantum doubling on every level down
+    //(setSimulatorLevels changes them)
+    sim->Levels = NULL;
+    sim->boost_interval = MLFQ_BOOST_INTERVAL;
+
+    //a quantum too large to double stays at the largest one (the same as the --level-quanta of the command line)
+    int levelQuantum = quantum;
+
+    for (int level = 0; level < MLFQ_MAX_LEVELS; level++)
+    {
+        sim->levelQuanta[level] = level < MLFQ_LEVELS ? levelQuantum : 0;
+        levelQuantum = levelQuantum > INT_MAX / 2 ? INT_MAX : levelQuantum * 2;
+    }
+
+    if (mode == 4)
+    {
+        sim->Levels = initMultilevelQueue(MLFQ_LEVELS);
+    }
+
+    //the completely fair scheduler's red-black tree (setSimulatorLatency changes its time slices)
+    sim->Fair = mode == 5 ? initFairQueue() : NULL;
+    sim->target_latency = CFS_TARGET_LATENCY;
+    sim->min_granularity = CFS_MIN_GRANULARITY;
+
+    //initializes the timer wheel the I/O of waiting processes is timed with
+    sim->IOTimers = initTimerWheel();
+
+    //initializes the list of the arrived processes that had no space in memory
+    sim->blocked = initBlockedList();
+
+    //no processes are loaded yet, they are either loaded into the array or read from a stream
+    sim->processes = NULL;
+    sim->numberOfProcesses = 0;
+    sim->stream = NULL;
+    sim->pool = NULL;
+    sim->arrivalOrder = NULL;
+    sim->sharedArrivalOrder = false;
+    sim->loaded = false;
+
+    //nothing has gone wrong yet
+    sim->failed = false;
+    sim->error[0] = '\0';
+
+    //no process has arrived yet
+    sim->arrived = 0;
+
+    //arrays for the processes arriving and the processes done with IO on a tick, they grow as needed
+    sim->arrivalsCapacity = 16;
+    sim->arrivals = (process_t **)malloc(sizeof(process_t *) * sim->arrivalsCapacity);
+    sim->finishedCapacity = 16;
+    sim->finishedIO = (process_t **)malloc(sizeof(process_t *) * sim->finishedCapacity);
+
+    //variable to represent the clock in ticks
+    sim->clock = 0;
+
+    //nothing is written until an output file is set, the accounting file only if one is written
+    sim->output = outputFileInit(NULL, TRACE_NONE);
+    sim->accounting = NULL;
+
+    //initializes the scheduling metrics
+    sim->metrics = initMetrics();
+
+    //initializes the current running process to NULL, there is no running process yet
+    sim->RunningProcess = NULL;
+
+    //variables for tracking if a process will timeout within the Round Robin Algorithm and the MLFQ
+    sim->timeout = 0;
+    sim->slice = 0;
+
+    //no process is in any state until the loaded ones are counted as NEW
+    memset(sim->stateCounts, 0, sizeof(sim->stateCounts));
+
+#ifdef SCHEDULER_STATS
+    memset(&sim->stats, 0, sizeof(sim->stats));
+    statsCalibrate(&sim->stats, STATS_CALIBRATION_TICKS);
+    sim->stats.clock_overhead = statsClockOverhead();
+#endif
+
+    return sim;
+}
+
+//Method to destroy a simulation (closes its files and frees everything it allocated)
+//parameters are: the simulation
+//returns nothing
+void destroySimulator(Simulator_t *sim)
+{
+    cleanOutputFile(sim->output);
+    cleanMetrics(sim->metrics);
+
+    if (sim->accounting != NULL)
+    {
+        closeAccounting(sim->accounting);
+    }
+    cleanReadyQueue(sim->ReadyQueue);
+    cleanPriorityQueue(sim->PriorityQueue);
+
+    if (sim->Levels != NULL)
+    {
+        cleanMultilevelQueue(sim->Levels);
+    }
+
+    if (sim->Fair != NULL)
+    {
+        cleanFairQueue(sim->Fair);
+    }
+    cleanTimerWheel(sim->IOTimers);
+    cleanBlockedList(sim->blocked);
+    free(sim->processes);
+    free(sim->arrivals);
+    free(sim->finishedIO);
+
+    //an arrival order shared with other simulations is freed by its owner
+    if (!sim->sharedArrivalOrder)
+    {
+        free((int *)sim->arrivalOrder);
+    }
+
+    if (sim->stream != NULL)
+    {
+        closeProcessStream(sim->stream);
+        cleanProcessPool(sim->pool);
+    }
+
+    free(sim);
+}
+
+//Method that checks a simulation does not have its processes yet, a simulation is only loaded once
+//parameters are: the simulation
+//returns true if it can be loaded, false (failing the simulation) otherwise
+static bool checkNotLoaded(Simulator_t *sim)
+{
+    if (sim->loaded)
+    {
+        return failSimulator(sim, "the processes of a simulation can only be loaded once");
+    }
+
+    sim->loaded = true;
+
+    return true;
+}
+
+//Method that reads every process of an input file into the simulation at once
+//parameters are: the simulation and the name of the input file
+//returns true if the file was loaded, false (failing the simulation) if it can not be read or is malformed
+bool loadSimulatorFile(Simulator_t *sim, const char *inputFile)
+{
+    if (!checkNotLoaded(sim))
+    {
+        return false;
+    }
+
+    int numberOfProcesses = 0;
+
+    // reads the input file in one pass and constructs the array of process structs with the correct values
+    sim->processes = loadProcesses(inputFile, sim->memory_scheme, &numberOfProcesses, sim->error);
+
+    if (sim->processes == NULL)
+    {
+        sim->failed = true;
+
+        return false;
+    }
+
+    sim->numberOfProcesses = numberOfProcesses;
+
+    //indexes the processes by arrival time so arrivals are found by advancing a cursor
+    sim->arrivalOrder = sortByArrival(sim->processes, numberOfProcesses);
+
+    //every process starts in the NEW state, the counts are updated on every transition
+    sim->stateCounts[NEW] = sim->numberOfProcesses;
+
+    return true;
+}
+
+//Method that opens an input file the simulation reads one process at a time, into slots that are recycled once
+//a process terminates
+//parameters are: the simulation and the name of the input file (sorted by arrival time)
+//returns true if the file was opened, false (failing the simulation) if it can not be read or its first line is
+//malformed (a later malformed line fails the simulation when it is read)
+bool streamSimulatorFile(Simulator_t *sim, const char *inputFile)
+{
+    if (!checkNotLoaded(sim))
+    {
+        return false;
+    }
+
+    //streamed processes are counted as NEW as they are read
+    sim->stream = openProcessStream(inputFile, sim->memory_scheme, sim->error);
+
+    if (sim->stream == NULL)
+    {
+        sim->failed = true;
+
+        return false;
+    }
+
+    sim->pool = initProcessPool();
+
+    return true;
+}
+
+//Method that loads a copy of already loaded processes into the simulation
+//parameters are: the simulation, the processes, their number, and their arrival order (shared, or NULL to sort them)
+//returns true if they were loaded, false (failing the simulation) if the simulation was already loaded
+bool loadSimulatorProcesses(Simulator_t *sim, const process_t *processes, int numberOfProcesses, const int *arrivalOrder)
+{
+    if (!checkNotLoaded(sim))
+    {
+        return false;
+    }
+
+    //the simulation changes its processes, so it gets its own copy
+    sim->processes = (process_t *)malloc(sizeof(process_t) * (numberOfProcesses > 0 ? numberOfProcesses : 1));
+    memcpy(sim->processes, processes, sizeof(process_t) * numberOfProcesses);
+    sim->numberOfProcesses = numberOfProcesses;
+
+    //the arrival order is only read, so a shared one is used as it is
+    if (arrivalOrder != NULL)
+    {
+        sim->arrivalOrder = arrivalOrder;
+        sim->sharedArrivalOrder = true;
+    }
+    else
+    {
+        sim->arrivalOrder = sortByArrival(sim->processes, numberOfProcesses);
+    }
+
+    sim->stateCounts[NEW] = sim->numberOfProcesses;
+
+    return true;
+}
+
+//Method that sets the levels of the multilevel feedback queue, before the processes are loaded
+//parameters are: the simulation, the number of levels, the quantum of every level (top level first) and the number
+//of ticks between boosts
+//returns true if they were set, false (failing the simulation) if a parameter is out of range
+bool setSimulatorLevels(Simulator_t *sim, int numberOfLevels, const int *quanta, int boost_interval)
+{
+    if (sim->loaded)
+    {
+        return failSimulator(sim, "the levels of the MLFQ have to be set before the processes are loaded");
+    }
+
+    if (boost_interval < 1)
+    {
+        return failSimulator(sim, "the boost interval has to be at least 1 tick");
+    }
+
+    //the levels have to fit in the bitmap of the multilevel feedback queue
+    if (numberOfLevels < 1 || numberOfLevels > MLFQ_MAX_LEVELS)
+    {
+        return failSimulator(sim, "a multilevel feedback queue has 1 to %d levels", MLFQ_MAX_LEVELS);
+    }
+
+    //a process has to run for at least a tick on a level before it is demoted
+    for (int level = 0; level < numberOfLevels; level++)
+    {
+        if (quanta[level] < 1)
+        {
+            return failSimulator(sim, "the quantum of every level has to be at least 1 tick");
+        }
+    }
+
+    MultilevelQueue_t *Levels = initMultilevelQueue(numberOfLevels);
+
+    for (int level = 0; level < numberOfLevels; level++)
+    {
+        sim->levelQuanta[level] = quanta[level];
+    }
+
+    if (sim->Levels != NULL)
+    {
+        cleanMultilevelQueue(sim->Levels);
+    }
+
+    //the queue is only used by the MLFQ, the levels are kept for the other modes anyway
+    if (sim->mode == 4)
+    {
+        sim->Levels = Levels;
+    }
+    else
+    {
+        cleanMultilevelQueue(Levels);
+    }
+
+    sim->boost_interval = boost_interval;
+
+    return true;
+}
+
+//Method that sets the time slices of the completely fair scheduler
+//parameters are: the simulation, the target latency and the minimum granularity in ticks
+//returns true if they were set, false (failing the simulation) if either is below 1 tick
+bool setSimulatorLatency(Simulator_t *sim, int target_latency, int min_granularity)
+{
+    if (target_latency < 1 || min_granularity < 1)
+    {
+        return failSimulator(sim, "the target latency and the minimum granularity have to be at least 1 tick");
+    }
+
+    sim->target_latency = target_latency;
+    sim->min_granularity = min_granularity;
+
+    return true;
+}
+
+//Method that opens the output file the transitions of the simulation are printed to
+//parameters are: the simulation, the name of the output file and its format
+//returns true if it was opened, false (failing the simulation, which keeps no output) otherwise
+bool setSimulatorOutput(Simulator_t *sim, const char *outputFile, TraceFormats format)
+{
+    cleanOutputFile(sim->output);
+    sim->output = outputFileInit(outputFile, format);
+
+    if (sim->output == NULL)
+    {
+        sim->output = outputFileInit(NULL, TRACE_NONE);
+
+        return failSimulator(sim, "Could not open output file %s: %s", outputFile, strerror(errno));
+    }
+
+    return true;
+}
+
+//Method that opens the accounting file every process of the simulation gets a row in when it terminates
+//parameters are: the simulation and the name of the accounting file
+//returns true if it was opened, false (failing the simulation) otherwise
+bool setSimulatorAccounting(Simulator_t *sim, const char *accountingFile)
+{
+    if (sim->accounting != NULL)
+    {
+        closeAccounting(sim->accounting);
+    }
+
+    sim->accounting = openAccounting(accountingFile);
+
+    if (sim->accounting == NULL)
+    {
+        return failSimulator(sim, "Could not open accounting file %s: %s", accountingFile, strerror(errno));
+    }
+
+    return true;
+}
+
+//Method that fails the simulation if a write to its output or accounting file has failed
+//the output is written by the writer thread and the accounting in blocks, so a failed write is seen some ticks later
+//parameters are: the simulation
+//returns nothing
+static void checkWrites(Simulator_t *sim)
+{
+    if (sim->output->error != 0)
+    {
+        failSimulator(sim, "Could not write to the output file: %s", strerror(sim->output->error));
+    }
+
+    if (sim->accounting != NULL && sim->accounting->error != 0)
+    {
+        failSimulator(sim, "Could not write to the accounting file: %s", strerror(sim->accounting->error));
+    }
+}
+
+//Method that closes the output and accounting files once every process is terminated, so the run fails if the end
+//of either can not be written (destroying the simulation would close them too late to tell)
+//parameters are: the simulation
+//returns nothing
+static void finishSimulation(Simulator_t *sim)
+{
+    int error = finishOutputFile(sim->output);
+
+    if (error != 0)
+    {
+        failSimulator(sim, "Could not write to the output file: %s", strerror(error));
+    }
+
+    if (sim->accounting != NULL)
+    {
+        error = closeAccounting(sim->accounting);
+        sim->accounting = NULL;
+
+        if (error != 0)
+        {
+            failSimulator(sim, "Could not write to the accounting file: %s", strerror(error));
+        }
+    }
+}
+
+//Function that returns why a simulation failed
+//parameters are: the simulation
+//returns the description of the error, or NULL if the simulation has not failed
+const char *getSimulatorError(Simulator_t *sim)
+{
+    return sim->failed ? sim->error : NULL;
+}
+
+//Method that runs the simulation until all processes are in a terminated state
+//parameters are: the simulation and the engine that runs it
+//returns true once every process is terminated, false if the simulation failed (see getSimulatorError)
+bool runSimulator(Simulator_t *sim, Engines engine)
+{
+#ifdef SCHEDULER_STATS
+    long long start = statsNow();
+    long long allocations = statsAllocations();
+#endif
+
+    if (engine == EVENT_ENGINE)
+    {
+        runEventEngine(sim);
+    }
+    else
+    {
+        runTickEngine(sim);
+    }
+
+#ifdef SCHEDULER_STATS
+    sim->stats.run_ns += statsNow() - start;
+    sim->stats.allocations = allocations < 0 ? -1 : sim->stats.allocations + statsAllocations() - allocations;
+#endif
+
+    return !sim->failed;
+}
+
+//Function to get the tick a simulation is on
+//parameters are the simulation
+//returns the clock
+long long getSimulatorClock(Simulator_t *sim)
+{
+    return sim->clock;
+}
+
+//Function to get the scheduling metrics of a simulation
+//parameters are the simulation
+//returns the metrics
+Metrics_t *getSimulatorMetrics(Simulator_t *sim)
+{
+    return sim->metrics;
+}
+
+//Method that prints the metrics of a simulation and its parameters
+//parameters are: the file, the simulation and true for one line of JSON instead of text
+//returns nothing
+void printSimulatorSummary(FILE *file, Simulator_t *sim, bool json)
+{
+    printSummary(file, sim->metrics, sim->mode, sim->memory_scheme, sim->quantum, sim->aging_interval, json);
+}
+
+//Function to tell if the main loop is instrumented
+//parameters are none
+//returns true if the library was built with SCHEDULER_STATS
+bool simulatorHasStats(void)
+{
+#ifdef SCHEDULER_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef SCHEDULER_STATS
+//Function to print one phase of the main loop in the stats table
+//parameters are: the file, the name of the phase, its count, its estimated time and the time of the run
+//returns nothing
+static void printStatPhase(FILE *file, const char *name, long long count, double ns, long long run_ns)
+{
+    fprintf(file, "  %-14s %14lld %12.3f %10.1f %7.2f%%\n", name, count, ns / 1e6, count > 0 ? ns / count : 0.0,
+            run_ns > 0 ? 100.0 * ns / run_ns : 0.0);
+}
+#endif
+
+//Function to print the instrumentation of the main loop
+//the time of a phase is measured on the first STATS_WINDOW_TICKS visited ticks and estimated from bursts of the
+//others, the process loop includes admission and trace (trace is also inside dispatch)
+//parameters are: the file and the simulation
+//returns nothing
+void printSimulatorStats(FILE *file, Simulator_t *sim)
+{
+#ifdef SCHEDULER_STATS
+    Stats_t *stats = &sim->stats;
+
+    static const char *names[STAT_PHASES] = {"aging", "dispatch", "process loop", "  admission", "  trace"};
+
+    double ns[STAT_PHASES];
+    double visited_ns = 0;
+
+    //the top-level phases run once per visited tick
+    for (int phase = STAT_AGING; phase <= STAT_PROCESS_LOOP; phase++)
+    {
+        stats->phases[phase].count = stats->ticks;
+    }
+
+    for (int phase = 0; phase < STAT_PHASES; phase++)
+    {
+        ns[phase] = statsEstimate(&stats->phases[phase]);
+
+        if (phase <= STAT_PROCESS_LOOP)
+        {
+            visited_ns += ns[phase];
+        }
+    }
+
+    //every flush is timed, only its clock read is taken out
+    const StatCounter_t *flushes = &sim->output->flushes;
+    double flush_ns = statsEstimate(flushes) - (double)flushes->count * stats->clock_overhead;
+
+    //the visited ticks are part of the run, the estimate can only go over it when the sampled ticks happened to be
+    //slower than the others, every phase is then scaled down to fit
+    double scale = visited_ns > stats->run_ns ? stats->run_ns / visited_ns : 1.0;
+
+    fprintf(file, "run: %.3f ms over %lld ticks (%lld visited)\n", stats->run_ns / 1e6, sim->clock, stats->ticks);
+    fprintf(file, "  %-14s %14s %12s %10s %8s\n", "phase", "count", "ms", "ns/call", "% run");
+
+    for (int phase = 0; phase < STAT_PHASES; phase++)
+    {
+        printStatPhase(file, names[phase], stats->phases[phase].count, ns[phase] * scale, stats->run_ns);
+    }
+
+    printStatPhase(file, "flushes", flushes->count, flush_ns > 0 ? flush_ns * scale : 0.0, stats->run_ns);
+
+    fprintf(file, "high water: ready %lld, waiting %lld, blocked %lld, events %lld\n", stats->ready_high_water,
+            stats->waiting_high_water, stats->blocked_high_water, stats->events_high_water);
+
+    if (stats->allocations >= 0)
+    {
+        fprintf(file, "allocations: %lld\n", stats->allocations);
+    }
+    else
+    {
+        fprintf(file, "allocations: not counted on this platform\n");
+    }
+#else
+    (void)file;
+    (void)sim;
+#endif
+}
+
+//Function to move a process into a new state and print the transition to the output file
+//parameters are: the simulation, the process and the state it transitions to
+//returns nothing
+static void changeState(Simulator_t *sim, process_t *process, States newState)
+{
+    //saves process's old state
+    States prevState = process->state;
+
+    //updates the process's state
+    process->state = newState;
+
+    //keeps the number of processes in each state up to date
+    sim->stateCounts[prevState]--;
+    sim->stateCounts[newState]++;
+
+    //accounts for the transition in the scheduling metrics
+    recordTransition(sim->metrics, process, prevState, sim->clock);
+
+    //prints transition to output file
+    STAT_START(&sim->stats, STAT_TRACE, trace);
+    printTransition(sim->output, sim->clock, process->pid, prevState, newState);
+    STAT_STOP(&sim->stats, STAT_TRACE, trace);
+}
+
+//Function that checks if the processes are scheduled by their (aged) priority
+//parameters are: the simulation
+//returns true with priority scheduling and preemptive priority scheduling
+static bool usesPriorities(Simulator_t *sim)
+{
+    return sim->mode == 2 || sim->mode == 8;
+}
+
+//Function that returns the number of processes waiting to be dispatched
+//parameters are: the simulation
+//returns the size of the ready queue, or of the priority queue with priority scheduling, SJF, SRTF and EDF
+static int readyQueueSize(Simulator_t *sim)
+{
+    if (usesPriorities(sim) || sim->mode == 6 || sim->mode == 7 || sim->mode == 9)
+    {
+        return getPriorityQueueSize(sim->PriorityQueue);
+    }
+
+    if (sim->mode == 4)
+    {
+        return getMultilevelQueueSize(sim->Levels);
+    }
+
+    if (sim->mode == 5)
+    {
+        return getFairQueueSize(sim->Fair);
+    }
+
+    return getQueueSize(sim->ReadyQueue);
+}
+
+//Function that ages the priority queue when the priority scheduler is used, and boosts the MLFQ
+//the first aging happens on tick aging_interval - 1 and then every aging_interval ticks, the queue's aging epoch
+//is brought up to the number of agings up to the current tick so ticks skipped by the event engine are caught up
+//the MLFQ is boosted on every multiple of boost_interval, the boosts of skipped ticks are caught up the same way
+//parameters are: the simulation
+//returns nothing
+static void agingStep(Simulator_t *sim)
+{
+    //if the scheduing algorithm is one of the priority schedulers
+    if (usesPriorities(sim))
+    {
+        long long epoch = (sim->clock + 1) / sim->aging_interval;
+
+        //age processes in the priority queue, O(1) however many processes are queued
+        age_priority_heap(sim->PriorityQueue, epoch - getAgingEpoch(sim->PriorityQueue));
+    }
+    //if the scheduling algorithm is the MLFQ, every process goes back to the top level
+    else if (sim->mode == 4)
+    {
+        mlfq_boost(sim->Levels, sim->clock / sim->boost_interval);
+    }
+}
+
+//Function that checks if the running process is timed out once it has run for a time slice
+//parameters are: the simulation
+//returns true with Round Robin, the MLFQ and CFS
+static bool usesTimeSlices(Simulator_t *sim)
+{
+    return sim->mode == 3 || sim->mode == 4 || sim->mode == 5;
+}
+
+//Function that returns the absolute deadline of a process, the rank it has on the heap with EDF
+//a process without a deadline comes after every process with one (first come first served among them)
+//parameters are: the process
+//returns the tick the process has to terminate by, LLONG_MAX if it has no deadline
+static long long absoluteDeadline(process_t *process)
+{
+    if (process->relative_deadline <= 0)
+    {
+        return LLONG_MAX;
+    }
+
+    //processes arriving before the first tick arrive on tick 0
+    return (long long)(process->arrival_time > 0 ? process->arrival_time : 0) + process->relative_deadline;
+}
+
+//Function that returns the time slice of a process dispatched by the completely fair scheduler
+//every ready process (the dispatched one included) gets a share of the target latency proportional to its weight,
+//and once there are more processes than target_latency / min_granularity the period grows so the equal share stays
+//min_granularity. A slice is never shorter than min_granularity.
+//parameters are: the simulation and the dispatched process
+//returns the time slice in ticks
+static int fairSlice(Simulator_t *sim, process_t *process)
+{
+    long long weight = fairWeight(process);
+    long long running = getFairQueueSize(sim->Fair) + 1;
+    long long period = sim->target_latency;
+
+    if (running > sim->target_latency / sim->min_granularity)
+    {
+        period = running * sim->min_granularity;
+    }
+
+    long long slice = period * weight / (getFairQueueWeight(sim->Fair) + weight);
+
+    return slice < sim->min_granularity ? sim->min_granularity : (int)(slice < INT_MAX ? slice : INT_MAX);
+}
+
+//Function that adds the ticks the running process has run for since it was dispatched to its vruntime, weighted
+//so a process with a heavier weight (a higher priority) gets a larger share of the CPU
+//parameters are: the simulation and the process leaving the RUNNING state
+//returns nothing
+static void chargeVruntime(Simulator_t *sim, process_t *process)
+{
+    long long ran = sim->clock - process->state_entered;
+
+    process->vruntime += ran * FAIR_NICE_0_WEIGHT * FAIR_NICE_0_WEIGHT / fairWeight(process);
+}
+
+//Function that checks if the head of the ready queue should run instead of the running process
+//with the MLFQ a process on a higher level than the running process's takes the CPU, with SRTF a process
+//needing strictly less CPU time than the running process has left does, and with preemptive priority scheduling a
+//process with a strictly better (lower) aged priority than the running process's does, and with EDF a process with
+//a strictly earlier deadline does. All are one comparison with the head.
+//The event engine only accounts the running process's work when this is true, before that its remaining CPU time is
+//the one it had when its burst started, which is never less than the real one, so a preemption is never missed.
+//parameters are: the simulation
+//returns true if there is a running process and a queued process that outranks it
+static bool outranksRunning(Simulator_t *sim)
+{
+    if (sim->RunningProcess == NULL || readyQueueSize(sim) == 0)
+    {
+        return false;
+    }
+
+    if (sim->mode == 4)
+    {
+        return getTopLevel(sim->Levels) < getProcessLevel(sim->Levels, sim->RunningProcess);
+    }
+
+    if (sim->mode == 7)
+    {
+        return getHeapHeadRank(sim->PriorityQueue) < sim->RunningProcess->current_CPU_time_needed;
+    }
+
+    if (sim->mode == 8)
+    {
+        process_t *head = priority_heap_peek(sim->PriorityQueue);
+
+        return getQueuedEffectivePriority(sim->PriorityQueue, head) < sim->RunningProcess->effective_priority;
+    }
+
+    if (sim->mode == 9)
+    {
+        return getHeapHeadRank(sim->PriorityQueue) < absoluteDeadline(sim->RunningProcess);
+    }
+
+    return false;
+}
+
+//Function that returns the tick on which aging alone makes the head of the priority queue outrank the running
+//process with preemptive priority scheduling (the running process is not aged, the queued processes are), so the
+//event engine visits it like the tick engine does
+//parameters are: the simulation
+//returns the tick of the aging the head gets a strictly better priority on, -1 if it never does by aging
+static long long agingPreemptionTick(Simulator_t *sim)
+{
+    if (sim->mode != 8 || sim->RunningProcess == NULL || readyQueueSize(sim) == 0)
+    {
+        return -1;
+    }
+
+    process_t *head = priority_heap_peek(sim->PriorityQueue);
+    int headPriority = getQueuedEffectivePriority(sim->PriorityQueue, head);
+    int runningPriority = sim->RunningProcess->effective_priority;
+
+    //aging stops at priority 0 and never changes a priority of 0 or lower, and a head that outranks the running
+    //process already preempts it on the next tick
+    if (runningPriority <= 0 || head->effective_priority <= 0 || headPriority < runningPriority)
+    {
+        return -1;
+    }
+
+    //the head needs headPriority - runningPriority + 1 more agings, aging number n happens on tick
+    //n * aging_interval - 1
+    long long agings = getAgingEpoch(sim->PriorityQueue) + headPriority - runningPriority + 1;
+
+    return agings * sim->aging_interval - 1;
+}
+
+//Function that checks if the running process is preempted on this tick
+//a process at the end of its CPU burst (done, needing IO or at the end of its time slice) leaves the CPU when it is
+//visited on this tick anyway, so it is not preempted
+//parameters are: the simulation
+//returns true if the running process goes back to the ready queue before the head of the ready queue is dispatched
+static bool preemptsRunning(Simulator_t *sim)
+{
+    if (!outranksRunning(sim))
+    {
+        return false;
+    }
+
+    process_t *process = sim->RunningProcess;
+
+    if (process->current_CPU_time_needed == 0 || process->current_time_until_IO == 0)
+    {
+        return false;
+    }
+
+    return !(usesTimeSlices(sim) && sim->timeout == sim->slice);
+}
+
+//Checks if there is no running process and the ready queue is not empty.
+//If conditions are met, the process within the head node of the ready queue becomes the new process
+//NOTE: only processes in the READY state can enter the ready queue, and transition to RUNNING when the 
+//condiions above are met.
+//parameters are: the simulation
+//returns the dispatched process, NULL if no process was dispatched
+static process_t *dispatchProcess(Simulator_t *sim)
+{
+    if (readyQueueSize(sim) == 0)
+    {
+        return NULL;
+    }
+
+    //a running process only gives up the CPU if a queued process outranks it (it keeps its level with the MLFQ)
+    if (sim->RunningProcess != NULL)
+    {
+        if (!preemptsRunning(sim))
+        {
+            return NULL;
+        }
+
+        process_t *preempted = sim->RunningProcess;
+
+        sim->RunningProcess = NULL;
+
+        readyProcess(sim, preempted);
+    }
+
+    //dequeues process from ready queue (the priority queue with priority scheduling, the highest non-empty level
+    //with the MLFQ)
+    process_t *process;
+
+    if (usesPriorities(sim))
+    {
+        process = priority_heap_dequeue(sim->PriorityQueue);
+    }
+    else if (sim->mode == 4)
+    {
+        process = mlfq_dequeue(sim->Levels);
+    }
+    else if (sim->mode == 5)
+    {
+        process = fair_dequeue(sim->Fair);
+    }
+    else if (sim->mode == 6 || sim->mode == 7 || sim->mode == 9)
+    {
+        process = keyed_heap_dequeue(sim->PriorityQueue);
+    }
+    else
+    {
+        process = dequeue(sim->ReadyQueue);
+    }
+
+    //updates the running process variable
+    sim->RunningProcess = process;
+
+    //resets process's current_time_until_IO variable to its IO frequency
+    process->current_time_until_IO = process->IO_frequency;
+
+    //resets priority of the process transitioning to running
+    //can be done in this transition because this algorithm does not use preemption so 
+    //the priority of the running is not important.
+    //(with preemptive priority scheduling it is the priority a queued process has to beat to preempt it)
+    if(usesPriorities(sim)){
+        //resets process's effective priority variable to its initial priority
+        process->effective_priority = process->initial_priority;
+
+        //if mode is Round Robin
+    }else if(sim->mode == 3){
+        
+        //reset timeout
+        sim->timeout = 0;
+        sim->slice = sim->quantum;
+
+        //if mode is the MLFQ, the time slice is the quantum of the process's level
+    }else if(sim->mode == 4){
+
+        //reset timeout
+        sim->timeout = 0;
+        sim->slice = sim->levelQuanta[getProcessLevel(sim->Levels, process)];
+
+        //if mode is CFS, the time slice is the process's share of the target latency
+    }else if(sim->mode == 5){
+
+        //reset timeout
+        sim->timeout = 0;
+        sim->slice = fairSlice(sim, process);
+    }
+
+    //updates the process's state
+    changeState(sim, process, RUNNING);
+
+    return process;
+}
+
+//Function that moves a process into the READY state and enqueues it on the ready queue
+//parameters are: the simulation and the process
+//returns nothing
+static void readyProcess(Simulator_t *sim, process_t *process)
+{
+    //if scheduling algorithm is priority scheduling 
+    if(usesPriorities(sim)){
+
+        //enqueues process onto a priority ready queue
+        priority_heap_enqueue(sim->PriorityQueue, process);
+
+    //enqueues process onto its level of the multilevel feedback queue
+    }else if(sim->mode == 4){
+
+        mlfq_enqueue(sim->Levels, process);
+
+    //enqueues process onto the red-black tree of the completely fair scheduler at its vruntime
+    }else if(sim->mode == 5){
+
+        long long min_vruntime = getMinVruntime(sim->Fair);
+
+        //a new process starts level with the processes already running, a process back from IO keeps its vruntime
+        //but gets at most half a target latency of credit for the time it slept (so it runs soon without
+        //monopolizing the CPU), a timed out or preempted process is charged for the time it ran
+        if (process->state == NEW)
+        {
+            process->vruntime = min_vruntime;
+        }
+        else if (process->state == WAITING)
+        {
+            long long credit = (long long)sim->target_latency * FAIR_NICE_0_WEIGHT / 2;
+
+            if (process->vruntime < min_vruntime - credit)
+            {
+                process->vruntime = min_vruntime - credit;
+            }
+        }
+        else if (process->state == RUNNING)
+        {
+            chargeVruntime(sim, process);
+        }
+
+        fair_enqueue(sim->Fair, process);
+
+    //enqueues process onto the heap ordered by the CPU time it still needs with SJF and SRTF
+    }else if(sim->mode == 6 || sim->mode == 7){
+
+        keyed_heap_enqueue(sim->PriorityQueue, process, process->current_CPU_time_needed);
+
+    //enqueues process onto the heap ordered by deadline with EDF
+    }else if(sim->mode == 9){
+
+        keyed_heap_enqueue(sim->PriorityQueue, process, absoluteDeadline(process));
+
+    // enqueues process onto normal queue if the scheduling algorithm is FCFS or Round Robin
+    }else{
+
+        //enqueues process onto the ready queue
+        enqueue(sim->ReadyQueue, process);
+
+    }
+
+    //updates the process's state
+    changeState(sim, process, READY);
+}
+
+//Function that moves the running process back to the ready queue at the end of its time slice
+//with the MLFQ the process is demoted to the level below (unless it is on the lowest level)
+//parameters are: the simulation and the process
+//returns nothing
+static void timeoutProcess(Simulator_t *sim, process_t *process)
+{
+    //resets the current running process to NULL, symbolizing there is currently no running process
+    sim->RunningProcess = NULL;
+
+    if (sim->mode == 4)
+    {
+        int level = getProcessLevel(sim->Levels, process);
+
+        if (level + 1 < sim->Levels->numberOfLevels)
+        {
+            process->mlfq_level = level + 1;
+        }
+    }
+
+    //enqueue the ready process
+    readyProcess(sim, process);
+}
+
+//Function that admits an arrived process (NEW to READY), if memory is used the process needs a partition first
+//parameters are: the simulation and the process
+//returns true if the process was admitted and false if there was no space for it in memory
+static bool admitProcess(Simulator_t *sim, process_t *process)
+{
+    if(sim->memory_scheme != 0){
+        STAT_START(&sim->stats, STAT_ADMISSION, admission);
+        int allocated = memory_manager(sim->partitions,ALLOCATE,process, sim->memory_scheme);
+        STAT_STOP(&sim->stats, STAT_ADMISSION, admission);
+
+        if(allocated == -1){
+            return false;
+        }
+    }
+
+    readyProcess(sim, process);
+
+    if( sim->memory_scheme != 0){
+        STAT_START(&sim->stats, STAT_TRACE, trace);
+        print_memory_information(sim->output, sim->partitions, sim->memory_scheme);
+        STAT_STOP(&sim->stats, STAT_TRACE, trace);
+    }
+
+    return true;
+}
+
+//Function that terminates the running process and frees its memory
+//parameters are: the simulation and the process
+//returns nothing
+static void terminateProcess(Simulator_t *sim, process_t *process)
+{
+    //updates the process's state
+    changeState(sim, process, TERMINATED);
+
+    //writes the history of the process to the accounting file before its slot can be recycled
+    if (sim->accounting != NULL)
+    {
+        recordAccounting(sim->accounting, process, sim->clock);
+    }
+
+    //resets the current running process to NULL, symbolizing there is currently no running process
+    sim->RunningProcess = NULL;
+
+    //frees the partition of the process (processes only hold a partition when a memory scheme is used)
+    if (sim->memory_scheme != 0)
+    {
+        memory_manager(sim->partitions,FREE, process, sim->memory_scheme);
+    }
+
+    //a streamed process is not needed anymore, its slot is recycled for the processes read after it
+    if (sim->pool != NULL)
+    {
+        releaseProcess(sim->pool, process);
+    }
+}
+
+//Function that moves the running process into the WAITING state and starts the timer for its I/O
+//a waiting process is done with IO once it has waited current_time_until_IO_is_finished ticks after this one
+//parameters are: the simulation and the process
+//returns nothing
+static void waitForIO(Simulator_t *sim, process_t *process)
+{
+    //the process is charged for the time it ran before it sleeps
+    if (sim->mode == 5)
+    {
+        chargeVruntime(sim, process);
+    }
+
+    //updates the process's state
+    changeState(sim, process, WAITING);
+
+    //resets the current running process to NULL, symbolizing there is currently no running process
+    sim->RunningProcess = NULL;
+
+    //the timer expires on the tick the process is done with IO
+    scheduleTimer(sim->IOTimers, process, sim->clock + 1 + process->current_time_until_IO_is_finished);
+}
+
+//Function that moves a waiting process that is done with IO into the READY state and enqueues it
+//parameters are: the simulation and the process
+//returns nothing
+static void finishIO(Simulator_t *sim, process_t *process)
+{
+    //the IO has no time left
+    process->current_time_until_IO_is_finished = 0;
+
+    readyProcess(sim, process);
+}
+
+//Function that compares the load order of two processes (for qsort)
+//parameters are pointers to two process pointers
+//returns a negative number, 0 or a positive number if the first process comes before, at or after the second
+static int compareProcessPositions(const void *a, const void *b)
+{
+    long long first = (*(process_t **)a)->load_order;
+    long long second = (*(process_t **)b)->load_order;
+
+    return (first > second) - (first < second);
+}
+
+//Function that advances the IO timers to the current tick and collects the processes that are done with IO
+//parameters are: the simulation
+//returns the number of processes done with IO, they are stored in sim->finishedIO in load order
+static int collectFinishedIO(Simulator_t *sim)
+{
+    int finishedCount = 0;
+
+    for (process_t *process = advanceTimerWheel(sim->IOTimers, sim->clock); process != NULL; process = process->timer_next)
+    {
+        //doubling the array when it is full
+        if (finishedCount == sim->finishedCapacity)
+        {
+            sim->finishedCapacity *= 2;
+            sim->finishedIO = (process_t **)realloc(sim->finishedIO, sizeof(process_t *) * sim->finishedCapacity);
+        }
+
+        sim->finishedIO[finishedCount++] = process;
+    }
+
+    //the processes have to transition in the order the tick loop visits them
+    qsort(sim->finishedIO, finishedCount, sizeof(process_t *), compareProcessPositions);
+
+    return finishedCount;
+}
+
+//Function that returns the next process that has arrived by the current tick, advancing the arrival cursor.
+//The processes are taken in order of arrival from the array sorted by arrival time, or read from the streamed input
+//into a slot of the pool. Processes arriving on the same tick come in load order.
+//parameters are: the simulation
+//returns the NEW process, or NULL if the next process has not arrived yet (or every process has)
+static process_t *nextArrival(Simulator_t *sim)
+{
+    if (sim->stream == NULL)
+    {
+        if (sim->arrived == sim->numberOfProcesses)
+        {
+            return NULL;
+        }
+
+        process_t *process = &sim->processes[sim->arrivalOrder[sim->arrived]];
+
+        if (process->arrival_time > sim->clock)
+        {
+            return NULL;
+        }
+
+        sim->arrived++;
+
+        return process;
+    }
+
+    const process_t *next = peekProcess(sim->stream);
+
+    if (next == NULL || next->arrival_time > sim->clock)
+    {
+        return NULL;
+    }
+
+    process_t *process = allocateProcess(sim->pool);
+
+    if (process == NULL)
+    {
+        failSimulator(sim, "Could not allocate the process arriving on tick %lld", sim->clock);
+
+        return NULL;
+    }
+
+    nextProcess(sim->stream, process);
+
+    //the line after this process could not be read, the simulation stops once this tick is done
+    if (sim->stream->failed)
+    {
+        failSimulator(sim, "%s", sim->stream->error);
+    }
+
+    //the process is counted as a NEW process from now on
+    sim->arrived++;
+    sim->numberOfProcesses++;
+    sim->stateCounts[NEW]++;
+
+    return process;
+}
+
+//Function that returns the tick the next process arrives on
+//parameters are: the simulation
+//returns the tick (processes arriving before the first tick arrive on tick 0), or -1 if every process has arrived
+static long long nextArrivalTime(Simulator_t *sim)
+{
+    const process_t *next = NULL;
+
+    if (sim->stream != NULL)
+    {
+        next = peekProcess(sim->stream);
+    }
+    else if (sim->arrived < sim->numberOfProcesses)
+    {
+        next = &sim->processes[sim->arrivalOrder[sim->arrived]];
+    }
+
+    if (next == NULL)
+    {
+        return -1;
+    }
+
+    return next->arrival_time > 0 ? next->arrival_time : 0;
+}
+
+//Function that runs one tick of the running process: it finishes its task, requests IO, times out with the
+//Round Robin algorithm, or runs for the tick
+//parameters are: the simulation and the running process
+//returns true if the process terminated
+static bool runningTick(Simulator_t *sim, process_t *process)
+{
+    // if a running process finishes it's task, it transitions to the TERMINATED state
+    if (process->current_CPU_time_needed == 0)
+    {
+        terminateProcess(sim, process);
+
+        return true;
+    }
+    //if a running process needs IO, it transitions to the WAITING state
+    else if (process->current_time_until_IO == 0)
+    {
+        waitForIO(sim, process);
+    }
+    // if it isn't time to request IO and the process's task has not finished
+    // decrements the process's current_time_until_IO and current_CPU_time_needed variables
+    else
+    {
+
+        //if schedule algorithm being used is the Round Robin algorithm or the MLFQ
+        if (usesTimeSlices(sim))
+        {
+
+            //if timeout variable is greater or equal to the time slice (100ms with Round Robin), then the process
+            //gets timed out and goes back to the ready queue
+            if (sim->timeout == sim->slice && process->current_CPU_time_needed != 0)
+            {
+                timeoutProcess(sim, process);
+
+                return false;
+            }
+
+            //increment the timeout variable
+            sim->timeout++;
+        }
+
+        process->current_time_until_IO--;
+        process->current_CPU_time_needed--;
+    }
+
+    return false;
+}
+
+//Function that runs the simulation one tick at a time.
+//Only the processes that can change state on a tick are visited: the processes arriving on the tick (found by
+//advancing the arrival cursor), the processes blocked on memory once a partition has been freed, the running
+//process, and the waiting processes whose IO timer expires.
+//READY processes wait on the ready queue and TERMINATED processes are never looked at again.
+//The visits happen in load order (the order of the input file), like the original loop over every process.
+//parameters are: the simulation
+//returns nothing
+static void runTickEngine(Simulator_t *sim)
+{
+    //runs ticks until all processes are in a terminated state
+    while (stepSimulator(sim))
+    {
+    }
+}
+
+//Function that runs one tick of the simulation for the tick engine
+//ASSUMES processes can not have multiple transisitons between states in 1 tick
+//ASSUMES processes on arrival will go into a ready state before being able to become the running process
+//parameters are: the simulation
+//returns false without running the tick if all processes are in a terminated state, true otherwise
+bool stepSimulator(Simulator_t *sim)
+{
+    if (sim->failed || isDone(sim))
+    {
+        return false;
+    }
+
+    //the arrived processes that had no space in memory
+    BlockedList_t *blocked = sim->blocked;
+
+    //ages the priority queue if it is time to
+    STAT_TICK(&sim->stats, phase);
+    agingStep(sim);
+    STAT_PHASE(&sim->stats, STAT_AGING, phase);
+
+    //dispatches the process at the head of the ready queue if there is no running process
+    dispatchProcess(sim);
+    STAT_PHASE(&sim->stats, STAT_DISPATCH, phase);
+
+    //advances the arrival cursor past the processes arriving on this tick
+    int arrivedCount = 0;
+
+    for (process_t *process = nextArrival(sim); process != NULL; process = nextArrival(sim))
+    {
+        //doubling the array when it is full
+        if (arrivedCount == sim->arrivalsCapacity)
+        {
+            sim->arrivalsCapacity *= 2;
+            sim->arrivals = (process_t **)realloc(sim->arrivals, sizeof(process_t *) * sim->arrivalsCapacity);
+        }
+
+        sim->arrivals[arrivedCount++] = process;
+    }
+
+    int nextArrived = 0;
+
+    //blocked processes try to get a partition again once one has been freed since their last try
+    bool retryBlocked = blockedRetryOnTick(blocked, sim->clock);
+    int nextBlocked = 0;
+
+    //collects the waiting processes whose IO timer expires on this tick
+    int finishedCount = collectFinishedIO(sim);
+    int nextFinished = 0;
+
+    //the running process is visited once, at its place in the load order
+    process_t *running = sim->RunningProcess;
+    long long runningOrder = running != NULL ? running->load_order : LLONG_MAX;
+
+    //visits the arriving processes, the blocked processes that retry, the running process and the processes
+    //done with IO in load order
+    while (true)
+    {
+        long long arrivedOrder = nextArrived < arrivedCount ? sim->arrivals[nextArrived]->load_order : LLONG_MAX;
+        long long blockedOrder = (retryBlocked && nextBlocked < blocked->size) ? blocked->processes[nextBlocked]->load_order : LLONG_MAX;
+        long long finishedOrder = nextFinished < finishedCount ? sim->finishedIO[nextFinished]->load_order : LLONG_MAX;
+
+        //if an arriving process comes first, it transitions to the READY state
+        //(waits on the blocked list if there is no space for it in memory)
+        if (arrivedOrder < blockedOrder && arrivedOrder < runningOrder && arrivedOrder < finishedOrder)
+        {
+            process_t *process = sim->arrivals[nextArrived++];
+
+            if (!admitProcess(sim, process))
+            {
+                blockProcess(blocked, process, &nextBlocked);
+                STAT_HIGH_WATER(sim->stats.blocked_high_water, blocked->size);
+            }
+        }
+        //if a blocked process comes first, it retries if a partition was freed since its last try
+        else if (blockedOrder < runningOrder && blockedOrder < finishedOrder)
+        {
+            if (canRetryBlocked(blocked, nextBlocked) && admitProcess(sim, blocked->processes[nextBlocked]))
+            {
+                unblockProcess(blocked, nextBlocked);
+            }
+            else
+            {
+                keepBlocked(blocked, &nextBlocked);
+            }
+        }
+        //if the running process comes first
+        else if (runningOrder < finishedOrder)
+        {
+            runningOrder = LLONG_MAX;
+
+            //the process's slot can be recycled once it terminates
+            long long order = running->load_order;
+
+            //the blocked processes after this one in load order can retry on this tick
+            if (runningTick(sim, running) && sim->memory_scheme != 0)
+            {
+                retryBlocked = true;
+                nextBlocked = recordFree(blocked, sim->clock, order);
+            }
+        }
+        //if a waiting process that is done with IO comes first, it transitions to the READY state and gets enqueued
+        else if (finishedOrder != LLONG_MAX)
+        {
+            finishIO(sim, sim->finishedIO[nextFinished++]);
+        }
+        //every process that can change state on this tick has been visited
+        else
+        {
+            break;
+        }
+    }
+
+    STAT_PHASE(&sim->stats, STAT_PROCESS_LOOP, phase);
+
+    //the processes READY and WAITING once the tick is done
+    STAT_HIGH_WATER(sim->stats.ready_high_water, sim->stateCounts[READY]);
+    STAT_HIGH_WATER(sim->stats.waiting_high_water, sim->stateCounts[WAITING]);
+
+    //nothing can happen anymore, the remaining processes never fit in memory (the same check as the event engine's)
+    if (!sim->failed && !isDone(sim) && sim->RunningProcess == NULL && readyQueueSize(sim) == 0 &&
+        nextTimerExpiry(sim->IOTimers) == -1 && nextArrivalTime(sim) == -1 && !blockedRetryOnTick(blocked, sim->clock + 1))
+    {
+        failSimulator(sim, "processes can never be given space in memory");
+    }
+
+    checkWrites(sim);
+
+    //the clock stays on the tick a simulation failed on
+    if (sim->failed)
+    {
+        return false;
+    }
+
+    //increments the value of the clock to represent time has elapsed
+    sim->clock++;
+
+    //the files are closed once the last process is terminated
+    if (isDone(sim))
+    {
+        finishSimulation(sim);
+    }
+
+    return !sim->failed;
+}
+
+//Function that returns the length of the CPU burst of the running process from the current tick
+//the burst ends when its task is done, when it needs IO, or when the rest of its time slice has run out
+//parameters are: the simulation and the running process
+//returns the number of ticks until the end of the burst
+static long long burstLength(Simulator_t *sim, process_t *process)
+{
+    long long length = process->current_CPU_time_needed;
+
+    if (process->current_time_until_IO < length)
+    {
+        length = process->current_time_until_IO;
+    }
+
+    if (usesTimeSlices(sim) && sim->slice - sim->timeout < length)
+    {
+        length = sim->slice - sim->timeout;
+    }
+
+    return length;
+}
+
+//Function that runs the simulation by jumping the clock from one event to the next.
+//CPU burst completions (task finished, I/O request or Round Robin timeout) are scheduled on an event queue, I/O
+//completions on the IO timer wheel, arrivals come from the arrival cursor, and the ticks in between are skipped
+//instead of being visited one at a time.
+//On every visited tick the same steps as the tick engine happen in the same order (aging, dispatch, then the
+//processes with a transition in load order), so the output is identical.
+//parameters are: the simulation
+//returns nothing
+static void runEventEngine(Simulator_t *sim)
+{
+    //the event queue, the arrivals are scheduled on the tick they happen on
+    EventQueue_t *events = initEventQueue(16);
+
+    //length of the CPU burst of the running process and the tick it started on, its BURST_END event is scheduled
+    //when it is dispatched
+    long long burst_length = 0;
+    long long burst_start = 0;
+
+    //number of the CPU burst of the running process, the BURST_END of a preempted burst is stale
+    long long bursts = 0;
+
+    //the arrived processes that had no space in memory
+    BlockedList_t *blocked = sim->blocked;
+
+    //a simulation that was stepped can already have a running process, its burst ends when the tick engine
+    //would have ended it (its task is done, it needs IO, or the rest of its time slice has run out)
+    if (sim->RunningProcess != NULL)
+    {
+        burst_length = burstLength(sim, sim->RunningProcess);
+        burst_start = sim->clock;
+
+        pushEvent(events, sim->clock + burst_length, sim->RunningProcess, BURST_END, ++bursts);
+    }
+
+    while (!sim->failed && !isDone(sim))
+    {
+        //ages the priority queue if it is time to
+        STAT_TICK(&sim->stats, phase);
+        agingStep(sim);
+        STAT_PHASE(&sim->stats, STAT_AGING, phase);
+
+        //dispatches the process at the head of the ready queue and schedules the end of its CPU burst
+        //the burst ends when its task is done, when it needs IO, or when it times out with Round Robin or the MLFQ
+
+        //a running process that can be preempted gets the work it has done since its burst started accounted
+        //first, so the dispatch sees it the way the tick engine does
+        if (outranksRunning(sim))
+        {
+            process_t *running = sim->RunningProcess;
+            long long elapsed = sim->clock - burst_start;
+
+            running->current_CPU_time_needed -= elapsed;
+            running->current_time_until_IO -= elapsed;
+            sim->timeout += elapsed;
+            burst_length -= elapsed;
+            burst_start = sim->clock;
+        }
+
+        process_t *dispatched = dispatchProcess(sim);
+
+        if (dispatched != NULL)
+        {
+            burst_length = burstLength(sim, dispatched);
+            burst_start = sim->clock;
+
+            pushEvent(events, sim->clock + burst_length, dispatched, BURST_END, ++bursts);
+        }
+
+        STAT_PHASE(&sim->stats, STAT_DISPATCH, phase);
+
+        //advances the arrival cursor past the processes arriving on this tick
+        for (process_t *arrived = nextArrival(sim); arrived != NULL; arrived = nextArrival(sim))
+        {
+            pushEvent(events, sim->clock, arrived, ARRIVAL, 0);
+        }
+
+        //the events of this tick are all on the queue now, none have been handled yet
+        STAT_HIGH_WATER(sim->stats.events_high_water, events->size);
+
+        //blocked processes try to get a partition again once one has been freed since their last try
+        bool retryBlocked = blockedRetryOnTick(blocked, sim->clock);
+        int nextBlocked = 0;
+
+        //collects the waiting processes whose IO timer expires on this tick
+        int finishedCount = collectFinishedIO(sim);
+        int nextFinished = 0;
+
+        //visits the processes with an event on this tick, the processes done with IO and the blocked processes
+        //that are retrying, in load order
+        while (true)
+        {
+            Event_t *next = peekEvent(events, bursts);
+
+            long long eventOrder = (next != NULL && next->time == sim->clock) ? next->process->load_order : LLONG_MAX;
+            long long finishedOrder = nextFinished < finishedCount ? sim->finishedIO[nextFinished]->load_order : LLONG_MAX;
+            long long blockedOrder = (retryBlocked && nextBlocked < blocked->size) ? blocked->processes[nextBlocked]->load_order : LLONG_MAX;
+
+            if (eventOrder == LLONG_MAX && finishedOrder == LLONG_MAX && blockedOrder == LLONG_MAX)
+            {
+                break;
+            }
+
+            //a waiting process done with IO comes first, it transitions to the READY state and gets enqueued
+            if (finishedOrder < eventOrder && finishedOrder < blockedOrder)
+            {
+                finishIO(sim, sim->finishedIO[nextFinished++]);
+
+                continue;
+            }
+
+            //a blocked process comes first, it retries if a partition was freed since its last try
+            if (blockedOrder < eventOrder)
+            {
+                if (canRetryBlocked(blocked, nextBlocked) && admitProcess(sim, blocked->processes[nextBlocked]))
+                {
+                    unblockProcess(blocked, nextBlocked);
+                }
+                else
+                {
+                    keepBlocked(blocked, &nextBlocked);
+                }
+
+                continue;
+            }
+
+            Event_t event = popEvent(events);
+            process_t *process = event.process;
+
+            //the process arrives, it transitions to the READY state if there is space for it in memory
+            if (event.type == ARRIVAL)
+            {
+                if (!admitProcess(sim, process))
+                {
+                    blockProcess(blocked, process, &nextBlocked);
+                    STAT_HIGH_WATER(sim->stats.blocked_high_water, blocked->size);
+                }
+            }
+            //the running process reaches the end of its CPU burst
+            else
+            {
+                process->current_CPU_time_needed -= burst_length;
+                process->current_time_until_IO -= burst_length;
+
+                // if a running process finishes it's task, it transitions to the TERMINATED state
+                if (process->current_CPU_time_needed == 0)
+                {
+                    //the process's slot can be recycled once it terminates
+                    long long order = process->load_order;
+
+                    terminateProcess(sim, process);
+
+                    //the blocked processes after this one in load order can retry on this tick
+                    if (sim->memory_scheme != 0)
+                    {
+                        retryBlocked = true;
+                        nextBlocked = recordFree(blocked, sim->clock, order);
+                    }
+                }
+                //if a running process needs IO, it transitions to the WAITING state
+                else if (process->current_time_until_IO == 0)
+                {
+                    waitForIO(sim, process);
+                }
+                //the process times out with Round Robin or the MLFQ and goes back to the ready queue
+                else
+                {
+                    sim->timeout = sim->slice;
+
+                    timeoutProcess(sim, process);
+                }
+            }
+        }
+
+        STAT_PHASE(&sim->stats, STAT_PROCESS_LOOP, phase);
+
+        //the processes READY and WAITING once the tick is done (nothing changes on the ticks skipped)
+        STAT_HIGH_WATER(sim->stats.ready_high_water, sim->stateCounts[READY]);
+        STAT_HIGH_WATER(sim->stats.waiting_high_water, sim->stateCounts[WAITING]);
+
+        checkWrites(sim);
+
+        if (sim->failed || isDone(sim))
+        {
+            break;
+        }
+
+        //finds the next tick on which something happens
+        long long nextTick = -1;
+        Event_t *next = peekEvent(events, bursts);
+
+        if (next != NULL)
+        {
+            nextTick = next->time;
+        }
+
+        //a waiting process is done with IO
+        long long nextIO = nextTimerExpiry(sim->IOTimers);
+
+        if (nextIO != -1 && (nextTick == -1 || nextIO < nextTick))
+        {
+            nextTick = nextIO;
+        }
+
+        //the next process arrives
+        long long arrival = nextArrivalTime(sim);
+
+        if (arrival != -1 && (nextTick == -1 || arrival < nextTick))
+        {
+            nextTick = arrival;
+        }
+
+        //the head of the priority queue ages enough to preempt the running process
+        long long preemption = agingPreemptionTick(sim);
+
+        if (preemption != -1 && (nextTick == -1 || preemption < nextTick))
+        {
+            nextTick = preemption;
+        }
+
+        //a process gets dispatched on the next tick (or preempts the running process)
+        //the blocked processes before the freed one in load order retry on the next tick
+        if ((readyQueueSize(sim) > 0 && sim->RunningProcess == NULL) || outranksRunning(sim) ||
+            blockedRetryOnTick(blocked, sim->clock + 1))
+        {
+            nextTick = sim->clock + 1;
+        }
+
+        //nothing can happen anymore, the remaining processes never fit in memory
+        if (nextTick == -1)
+        {
+            failSimulator(sim, "processes can never be given space in memory");
+            break;
+        }
+
+        //jumps the clock to the next tick on which something happens
+        sim->clock = nextTick;
+    }
+
+    //the files are closed once the last process is terminated
+    if (!sim->failed && isDone(sim))
+    {
+        finishSimulation(sim);
+    }
+
+    cleanEventQueue(events);
+}
+
+
+//Function to check if all the processes have finished executing
+//uses the count of TERMINATED processes kept up to date by changeState instead of scanning the processes
+//parameters are the simulation
+//returns true if all processes are in a TERMINATED state and false otherwise
+bool isDone(Simulator_t *sim)
+{
+    //a streamed input is only done once every process has been read
+    if (sim->stream != NULL && peekProcess(sim->stream) != NULL)
+    {
+        return false;
+    }
+
+    return sim->stateCounts[TERMINATED] == sim->numberOfProcesses;
+}
+
+//Function to get the number of processes currently in a state
+//parameters are the simulation and a state
+//returns the number of processes in that state
+long long getStateCount(Simulator_t *sim, States state)
+{
+    return sim->stateCounts[state];
+}
+
+
+
+
+//function for printing the details of a process (for debugging)
+//parameters is a process struct
+//returns nothing
+void print_process_details(process_t process)
+{
+    //prints the state of a process for debugging
+    printf("Pid: %d \t, arrival_time: %d \t, total_CPU_time: %d \t, IO_frequency: %d \t, IO_duration: %d \t, state: %s \t \n",
+           process.pid, process.arrival_time, process.total_CPU_time, process.IO_frequency, process.IO_duration, getStringFromState(process.state));
+}
+
+//REFERENCES:-
+//1. https://www.tutorialspoint.com/c_standard_library/
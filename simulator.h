@@ -0,0 +1,124 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "process.h"
+#include "trace.h"
+#include "metrics.h"
+
+/* ======================================================
+ * KERNEL SIMULATOR
+ * ======================================================
+ */
+
+//The scheduling algorithms are modes 1 to LAST_MODE, the memory schemes 0 (unused) to LAST_MEMORY_SCHEME
+static const int LAST_MODE = 9;
+static const int LAST_MEMORY_SCHEME = 2;
+
+//Default for the Round Robin timeout, 100ms assuming 1 tick is 1 ms
+static const int TIMEOUT_AMOUNT = 100;
+
+//Default for how many ticks pass between agings of the priority queue
+static const int AGING_INTERVAL = 10;
+
+//Defaults for the multilevel feedback queue: the number of levels (the quantum doubles on every level down from the
+//Round Robin timeout) and how many ticks pass between boosts of every process back to the top level
+static const int MLFQ_LEVELS = 3;
+static const int MLFQ_BOOST_INTERVAL = 1000;
+
+//Defaults for the completely fair scheduler: the ticks in which every ready process runs once (while there are few
+//enough) and the shortest time slice
+static const int CFS_TARGET_LATENCY = 24;
+static const int CFS_MIN_GRANULARITY = 3;
+
+//The different engines that can drive the simulation
+typedef enum Engine_Type
+{
+    TICK_ENGINE, // Advances the clock one tick at a time and visits every process on every tick
+    EVENT_ENGINE // Jumps the clock straight to the next tick on which something happens
+} Engines;
+
+//The state of a simulation. Every simulation keeps all of its state in its own Simulator_t (there is no global
+//state), so any number of them can run at once, each on one thread.
+typedef struct Simulator Simulator_t;
+
+//Creates a simulation with no processes and no output file yet.
+//mode is 1 for FCFS, 2 for Priority Scheduling, 3 for Round Robin, 4 for the multilevel feedback queue (MLFQ),
+//5 for the completely fair scheduler (CFS), 6 for shortest job first (SJF), 7 for shortest remaining time first
+//(SRTF, the preemptive SJF), 8 for preemptive Priority Scheduling, 9 for earliest deadline first (EDF),
+//memory_scheme is 0 if unused, 1 or 2 for the preset partition schemes.
+//Returns NULL for an unknown mode or memory scheme, or if the quantum or the aging interval is below 1 tick.
+Simulator_t *createSimulator(int mode, int memory_scheme, int quantum, int aging_interval);
+
+//Closes the files of a simulation (flushing its output) and frees everything it allocated.
+void destroySimulator(Simulator_t *sim);
+
+//The functions below that return a bool return false when they fail, the simulation is then failed: it does not run
+//anymore and getSimulatorError says why. It still has to be destroyed.
+
+//Loading functions, a simulation is loaded once, before it runs.
+//loadSimulatorFile reads the whole input file at once, streamSimulatorFile reads it one process at a time just
+//before each arrival (the file has to be sorted by arrival time).
+//They fail if the file can not be read or a line is malformed (a streamed line when it is read).
+bool loadSimulatorFile(Simulator_t *sim, const char *inputFile);
+bool streamSimulatorFile(Simulator_t *sim, const char *inputFile);
+
+//Loads a copy of already loaded processes. arrivalOrder is their order from sortByArrival, it is only read and has
+//to stay alive until the simulation is destroyed (so it can be shared by many simulations), or NULL to sort them.
+bool loadSimulatorProcesses(Simulator_t *sim, const process_t *processes, int numberOfProcesses, const int *arrivalOrder);
+
+//Sets the number of levels of the MLFQ (1 to MLFQ_MAX_LEVELS), the quantum of every level (top level first) and the
+//ticks between boosts, before the processes are loaded. Fails if a quantum or the boost interval is below 1 tick.
+bool setSimulatorLevels(Simulator_t *sim, int numberOfLevels, const int *quanta, int boost_interval);
+
+//Sets the target latency and the minimum granularity of the CFS time slices, in ticks.
+//Fails if either is below 1 tick.
+bool setSimulatorLatency(Simulator_t *sim, int target_latency, int min_granularity);
+
+//Opens the output file the transitions are printed to, in a format (nothing is written until one is set).
+//The output and accounting files are closed once the last process is terminated, a write to either that fails
+//fails the simulation a few ticks later (or on the last tick).
+bool setSimulatorOutput(Simulator_t *sim, const char *outputFile, TraceFormats format);
+
+//Opens the accounting file every process gets a row in when it terminates.
+bool setSimulatorAccounting(Simulator_t *sim, const char *accountingFile);
+
+//Runs one tick of the simulation.
+//Returns false without running a tick if every process is already terminated or the simulation failed, and false
+//after running the tick if the remaining processes can never be given space in memory or a write to the output or
+//accounting file failed (the simulation fails).
+bool stepSimulator(Simulator_t *sim);
+
+//Runs the simulation until every process is terminated, the event engine can resume a simulation that was stepped.
+//Returns false if the simulation failed, both engines fail on the same tick when the remaining processes can never
+//be given space in memory.
+bool runSimulator(Simulator_t *sim, Engines engine);
+
+//Returns the description of why the simulation failed, or NULL if it has not failed.
+const char *getSimulatorError(Simulator_t *sim);
+
+//Returns true once every process is in the TERMINATED state.
+bool isDone(Simulator_t *sim);
+
+//Returns the number of processes currently in a state.
+long long getStateCount(Simulator_t *sim, States state);
+
+//Returns the tick the simulation is on.
+long long getSimulatorClock(Simulator_t *sim);
+
+//Returns the scheduling metrics accumulated so far (owned by the simulation).
+Metrics_t *getSimulatorMetrics(Simulator_t *sim);
+
+//Prints the metrics of the simulation and its parameters as text or as one line of JSON.
+void printSimulatorSummary(FILE *file, Simulator_t *sim, bool json);
+
+//Returns true if the library was built with the instrumentation of the main loop (cmake -DSCHEDULER_STATS=ON).
+bool simulatorHasStats(void);
+
+//Prints how many times each phase of the main loop ran and the time spent in it, the high-water marks of the queues
+//and the heap allocations made while running (prints nothing without the instrumentation).
+void printSimulatorStats(FILE *file, Simulator_t *sim);
+
+#endif //SIMULATOR_H
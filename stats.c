@@ -0,0 +1,104 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "stats.h"
+
+void statsTiming(Stats_t *stats)
+{
+    long long tick = stats->ticks - 1;
+
+    //first of the STATS_SAMPLE visited ticks the tick is in, their burst starts on it
+    long long burst = tick & ~(long long)(STATS_SAMPLE - 1);
+
+    if (tick < STATS_WINDOW_TICKS)
+    {
+        stats->timing = STATS_WINDOW;
+        stats->next_timing = STATS_WINDOW_TICKS;
+    }
+    else if (tick < burst + STATS_WARMUP)
+    {
+        stats->timing = STATS_WARMING;
+        stats->next_timing = burst + STATS_WARMUP;
+
+        //the overheads are measured again in the conditions of the run, while the timing code warms up
+        statsCalibrate(stats, STATS_WARMUP);
+    }
+    else if (tick < burst + STATS_BURST)
+    {
+        stats->timing = STATS_SAMPLED;
+        stats->next_timing = burst + STATS_BURST;
+    }
+    else
+    {
+        stats->timing = STATS_UNTIMED;
+        stats->next_timing = burst + STATS_SAMPLE;
+    }
+}
+
+void statsCalibrate(Stats_t *stats, int rounds)
+{
+    Stats_t empty;
+
+    memset(&empty, 0, sizeof(empty));
+
+    //empty ticks timed the way the main loop times its ticks: empty phases, one of them with an empty phase inside
+    for (int i = 0; i < rounds; i++)
+    {
+        empty.ticks = 0;
+        empty.next_timing = 0;
+
+        STAT_TICK(&empty, phase);
+        STAT_PHASE(&empty, STAT_AGING, phase);
+        STAT_START(&empty, STAT_TRACE, nested);
+        STAT_STOP(&empty, STAT_TRACE, nested);
+        STAT_PHASE(&empty, STAT_DISPATCH, phase);
+    }
+
+    //an empty phase takes only the time of its timing, the overheads are the means over every calibration so far
+    stats->calibrations += rounds;
+    stats->calibration_ns[STAT_AGING] += empty.phases[STAT_AGING].window_ns;
+    stats->calibration_ns[STAT_DISPATCH] += empty.phases[STAT_DISPATCH].window_ns;
+    stats->calibration_ns[STAT_TRACE] += empty.phases[STAT_TRACE].window_ns;
+
+    stats->phase_overhead = stats->calibration_ns[STAT_AGING] / stats->calibrations;
+    stats->nested_overhead = stats->calibration_ns[STAT_TRACE] / stats->calibrations;
+    stats->enclosing_overhead = stats->calibration_ns[STAT_DISPATCH] / stats->calibrations - stats->phase_overhead;
+}
+
+#ifdef STATS_COUNT_ALLOCATIONS
+//number of heap allocations made by each thread, each simulation runs on one thread
+static _Thread_local long long allocations = 0;
+
+//the linker sends every allocation here (-Wl,--wrap=malloc and so on)
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *pointer, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    allocations++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *pointer, size_t size)
+{
+    allocations++;
+    return __real_realloc(pointer, size);
+}
+
+long long statsAllocations()
+{
+    return allocations;
+}
+#else
+long long statsAllocations()
+{
+    return -1;
+}
+#endif
@@ -0,0 +1,251 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdio.h>
+#include <time.h>
+
+/* ======================================================
+ * HOT-PATH INSTRUMENTATION
+ * ======================================================
+ */
+
+//Instrumentation of the main loop, only compiled in when the build defines SCHEDULER_STATS
+//(cmake -DSCHEDULER_STATS=ON). Without it every STAT_ macro expands to nothing, so a normal build pays nothing.
+//With it, every phase is counted exactly and whole visited ticks are timed: every phase of the first visited ticks,
+//then every phase of short bursts of visited ticks (the time of the other ticks is estimated from them). The phases
+//of a timed tick share their clock reads, one read ends a phase and starts the next, and the time the timing adds to
+//a phase (measured on empty phases, in the conditions of the run) is taken out of every timed run.
+
+//The phases of a run that are counted and timed
+typedef enum Stat_Phase
+{
+    STAT_AGING,        // Aging of the priority queue (once per visited tick).
+    STAT_DISPATCH,     // Dispatch of the head of the ready queue (once per visited tick).
+    STAT_PROCESS_LOOP, // Visits of the processes with a transition (once per visited tick).
+    STAT_ADMISSION,    // Admissions through the memory manager (inside the process loop).
+    STAT_TRACE,        // Formatting of transitions and memory information (inside dispatch and the process loop).
+    STAT_PHASES        // Number of phases.
+} StatPhases;
+
+//The first STATS_WINDOW_TICKS visited ticks are all timed, then STATS_BURST visited ticks in a row out of every
+//STATS_SAMPLE (a power of 2). The timing code and the clock are cold after the ticks that are not timed, so the
+//first STATS_WARMUP ticks of a burst warm them up and their times are not kept.
+#define STATS_WINDOW_TICKS 1024
+#define STATS_SAMPLE 8192
+#define STATS_BURST 32
+#define STATS_WARMUP 8
+
+//Number of empty ticks timed to measure the overheads of the instrumentation when a simulation is created
+#define STATS_CALIBRATION_TICKS 256
+
+//How a visited tick is timed
+typedef enum Stat_Timing
+{
+    STATS_UNTIMED, // The tick is only counted.
+    STATS_WINDOW,  // The tick is one of the first STATS_WINDOW_TICKS, which are all timed.
+    STATS_WARMING, // The tick is one of the first STATS_WARMUP of a burst, timed but the times are not kept.
+    STATS_SAMPLED  // The tick is in a burst after them.
+} StatTimings;
+
+//Counts and time of one phase
+typedef struct StatCounter
+{
+    long long count;     // Number of runs of the phase (the visited ticks for the top-level phases).
+    long long window;    // Number of runs in the first STATS_WINDOW_TICKS visited ticks (all timed).
+    long long window_ns; // Nanoseconds spent in them.
+    long long timed;     // Number of runs timed in the bursts after them (or every run of a phase timed on its own).
+    long long ns;        // Nanoseconds spent in them.
+} StatCounter_t;
+
+//Instrumentation of a simulation
+typedef struct Stats
+{
+    StatCounter_t phases[STAT_PHASES]; // Counts and times of every phase.
+    long long ticks;                   // Number of visited ticks.
+    StatTimings timing;                // How the current visited tick is timed.
+    long long next_timing;             // Visited tick the timing changes on next.
+    long long nested;                  // Number of phases timed inside the current top-level phase.
+    long long ready_high_water;        // Most processes READY at once.
+    long long waiting_high_water;      // Most processes WAITING at once.
+    long long blocked_high_water;      // Most processes waiting for memory at once.
+    long long events_high_water;       // Most events on the event queue at once.
+    long long allocations;             // Heap allocations (malloc, calloc and realloc calls) while running, -1 if not counted.
+    long long run_ns;                  // Time spent running the simulation.
+    long long calibrations;            // Number of empty ticks timed to measure the overheads below.
+    long long calibration_ns[STAT_PHASES]; // Time of their empty aging phase, their dispatch phase (with a phase
+                                       // timed inside it) and that phase inside it.
+    long long phase_overhead;          // Time the timing adds to a top-level phase.
+    long long nested_overhead;         // Time the timing adds to a phase timed inside a top-level phase.
+    long long enclosing_overhead;      // Time timing a phase inside a top-level phase adds to the top-level phase.
+    long long clock_overhead;          // Mean time of a clock read, taken out of the phases timed on their own.
+} Stats_t;
+
+//Function that returns the current time in nanoseconds.
+static inline long long statsNow()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+//Function that returns the mean time of a clock read, which every run timed on its own includes once (the end of the
+//read that starts it and the start of the read that stops it).
+//Return:- the mean of many back to back reads, in nanoseconds.
+static inline long long statsClockOverhead()
+{
+    const int reads = 1024;
+    long long start = statsNow();
+
+    for (int i = 0; i < reads; i++)
+    {
+        statsNow();
+    }
+
+    return (statsNow() - start) / (reads + 1);
+}
+
+//Method that adds a timed run to the window or to the sampled runs of a phase.
+//Parameter:- counter, the counter of the phase.
+//Parameter:- timing, how the visited tick the run is in is timed.
+//Parameter:- ns, the time of the run without the clock reads.
+//Return:- N/A.
+static inline void statsRecord(StatCounter_t *counter, StatTimings timing, long long ns)
+{
+    if (timing == STATS_WINDOW)
+    {
+        counter->window++;
+        counter->window_ns += ns;
+    }
+    else if (timing == STATS_SAMPLED)
+    {
+        counter->timed++;
+        counter->ns += ns;
+    }
+}
+
+//Function that ends a top-level phase of a timed tick, the clock read also starts the next phase.
+//Parameter:- stats, the instrumentation of the simulation.
+//Parameter:- counter, the counter of the phase.
+//Parameter:- start, the time the phase started.
+//Return:- the time the phase ended.
+static inline long long statsPhase(Stats_t *stats, StatCounter_t *counter, long long start)
+{
+    long long now = statsNow();
+
+    //the phase includes the time of its own timing and of the timing of every phase timed inside it
+    statsRecord(counter, stats->timing, now - start - stats->phase_overhead - stats->nested * stats->enclosing_overhead);
+    stats->nested = 0;
+
+    return now;
+}
+
+//Method that stops timing a phase inside a top-level phase of a timed tick.
+//Parameter:- stats, the instrumentation of the simulation.
+//Parameter:- counter, the counter of the phase.
+//Parameter:- start, the time the phase started.
+//Return:- N/A.
+static inline void statsNested(Stats_t *stats, StatCounter_t *counter, long long start)
+{
+    statsRecord(counter, stats->timing, statsNow() - start - stats->nested_overhead);
+    stats->nested++;
+}
+
+//Function that counts a run of a phase timed on its own (outside the timed ticks) and starts timing it.
+//Parameter:- counter, the counter of the phase.
+//Return:- the start time.
+static inline long long statsStart(StatCounter_t *counter)
+{
+    counter->count++;
+    return statsNow();
+}
+
+//Method that stops timing a run of a phase timed on its own, the clock reads are taken out when it is printed.
+//Parameter:- counter, the counter of the phase.
+//Parameter:- start, the time returned by statsStart.
+//Return:- N/A.
+static inline void statsStop(StatCounter_t *counter, long long start)
+{
+    counter->ns += statsNow() - start;
+    counter->timed++;
+}
+
+//Function that returns the estimated nanoseconds spent in a phase: the time of its runs in the first STATS_WINDOW_TICKS
+//visited ticks, plus the time of its sampled runs scaled to the other runs.
+//Parameter:- counter, the counter of the phase.
+//Return:- the estimated time.
+static inline double statsEstimate(const StatCounter_t *counter)
+{
+    double ns = (double)counter->window_ns;
+
+    if (counter->timed > 0)
+    {
+        ns += (double)counter->ns * (counter->count - counter->window) / counter->timed;
+    }
+
+    return ns > 0 ? ns : 0.0;
+}
+
+//Sets how the visited tick that just started is timed, and the visited tick the timing changes on next.
+void statsTiming(Stats_t *stats);
+
+//Measures the time the timing adds to the phases (the overheads of the instrumentation) by timing a number of empty
+//ticks, when the simulation is created and again at the start of every burst.
+void statsCalibrate(Stats_t *stats, int rounds);
+
+//Returns the number of heap allocations made on the calling thread so far, -1 if they are not counted
+//(allocations are counted on Linux by wrapping malloc, calloc and realloc at link time).
+long long statsAllocations();
+
+#ifdef SCHEDULER_STATS
+//the counts and the timing tests are written out here instead of calling a function, so the ticks that are not timed
+//cost an increment and a branch or two even when nothing is inlined (the default build does not optimise)
+//STAT_TICK starts a visited tick (and its first phase), STAT_PHASE ends a top-level phase and starts the next one
+//(the top-level phases run once per visited tick, they are counted by STAT_TICK)
+#define STAT_TICK(stats, name)                          \
+    if ((stats)->ticks++ == (stats)->next_timing)       \
+    {                                                   \
+        statsTiming((stats));                           \
+    }                                                   \
+    long long name = (stats)->timing != STATS_UNTIMED ? statsNow() : 0
+#define STAT_PHASE(stats, phase, name)                                          \
+    do                                                                          \
+    {                                                                           \
+        if (name != 0)                                                          \
+        {                                                                       \
+            name = statsPhase((stats), &(stats)->phases[phase], name);          \
+        }                                                                       \
+    } while (0)
+//STAT_START and STAT_STOP time a phase inside a top-level phase, on the timed ticks
+#define STAT_START(stats, phase, name) \
+    (stats)->phases[phase].count++;    \
+    long long name = (stats)->timing != STATS_UNTIMED ? statsNow() : 0
+#define STAT_STOP(stats, phase, name)                                  \
+    do                                                                 \
+    {                                                                  \
+        if (name != 0)                                                 \
+        {                                                              \
+            statsNested((stats), &(stats)->phases[phase], name);       \
+        }                                                              \
+    } while (0)
+//STAT_START_EVERY and STAT_STOP_EVERY time every run of a phase that is not part of a tick
+#define STAT_START_EVERY(counter, name) long long name = statsStart((counter))
+#define STAT_STOP_EVERY(counter, name) statsStop((counter), name)
+#define STAT_HIGH_WATER(field, value) \
+    do                                \
+    {                                 \
+        if ((value) > (field))        \
+        {                             \
+            (field) = (value);        \
+        }                             \
+    } while (0)
+#else
+#define STAT_TICK(stats, name)
+#define STAT_PHASE(stats, phase, name)
+#define STAT_START(stats, phase, name)
+#define STAT_STOP(stats, phase, name)
+#define STAT_START_EVERY(counter, name)
+#define STAT_STOP_EVERY(counter, name)
+#define STAT_HIGH_WATER(field, value)
+#endif
+
+#endif //STATS_H
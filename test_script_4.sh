@@ -0,0 +1,57 @@
+
+# testing script testing first 3 testing input.txt files and input_test_5.txt
+# (input_test_5.txt has processes arriving on the top level while a process of a lower level runs (preemptions))
+
+# for testing the multilevel feedback queue scheduler
+
+echo "running test script #4 .... \n"
+
+#----------------------------------------------------------------
+# testing scenario 11
+
+echo "running scenario #11 .... \n"
+
+./assignment2 4 0 input_test_1.txt output_test_4_scenario_11.txt
+
+echo "ran test scenario #11 ...."
+
+echo "output file \"output_test_4_scenario_11.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 12
+echo "running scenario #12 .... \n"
+
+./assignment2 4 0 input_test_2.txt output_test_4_scenario_12.txt
+
+echo "ran test scenario #12 ...."
+
+echo "output file \"output_test_4_scenario_12.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 13
+
+echo "running scenario #13 .... \n"
+
+./assignment2 4 0 input_test_3.txt output_test_4_scenario_13.txt
+
+echo "ran test scenario #13 ...."
+
+echo "output file \"output_test_4_scenario_13.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 14
+
+echo "running scenario #14 .... \n"
+
+./assignment2 4 0 input_test_5.txt output_test_4_scenario_14.txt
+
+echo "ran test scenario #14 ...."
+
+echo "output file \"output_test_4_scenario_14.txt\" was generated \n"
+
+#----------------------------------------------------------------
+
+echo "finished running test script #4 ...."
\ No newline at end of file
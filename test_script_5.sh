@@ -0,0 +1,57 @@
+
+# testing script testing first 3 testing input.txt files and input_test_5.txt
+# (input_test_5.txt has processes arriving while others run, for the time slices)
+
+# for testing the completely fair scheduler
+
+echo "running test script #5 .... \n"
+
+#----------------------------------------------------------------
+# testing scenario 15
+
+echo "running scenario #15 .... \n"
+
+./assignment2 5 0 input_test_1.txt output_test_5_scenario_15.txt
+
+echo "ran test scenario #15 ...."
+
+echo "output file \"output_test_5_scenario_15.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 16
+echo "running scenario #16 .... \n"
+
+./assignment2 5 0 input_test_2.txt output_test_5_scenario_16.txt
+
+echo "ran test scenario #16 ...."
+
+echo "output file \"output_test_5_scenario_16.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 17
+
+echo "running scenario #17 .... \n"
+
+./assignment2 5 0 input_test_3.txt output_test_5_scenario_17.txt
+
+echo "ran test scenario #17 ...."
+
+echo "output file \"output_test_5_scenario_17.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 18
+
+echo "running scenario #18 .... \n"
+
+./assignment2 5 0 input_test_5.txt output_test_5_scenario_18.txt
+
+echo "ran test scenario #18 ...."
+
+echo "output file \"output_test_5_scenario_18.txt\" was generated \n"
+
+#----------------------------------------------------------------
+
+echo "finished running test script #5 ...."
\ No newline at end of file
@@ -0,0 +1,57 @@
+
+# testing script testing first 3 testing input.txt files and input_test_5.txt
+# (input_test_5.txt has shorter processes arriving while a longer one runs (no preemption))
+
+# for testing the shortest job first scheduler
+
+echo "running test script #6 .... \n"
+
+#----------------------------------------------------------------
+# testing scenario 19
+
+echo "running scenario #19 .... \n"
+
+./assignment2 6 0 input_test_1.txt output_test_6_scenario_19.txt
+
+echo "ran test scenario #19 ...."
+
+echo "output file \"output_test_6_scenario_19.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 20
+echo "running scenario #20 .... \n"
+
+./assignment2 6 0 input_test_2.txt output_test_6_scenario_20.txt
+
+echo "ran test scenario #20 ...."
+
+echo "output file \"output_test_6_scenario_20.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 21
+
+echo "running scenario #21 .... \n"
+
+./assignment2 6 0 input_test_3.txt output_test_6_scenario_21.txt
+
+echo "ran test scenario #21 ...."
+
+echo "output file \"output_test_6_scenario_21.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 22
+
+echo "running scenario #22 .... \n"
+
+./assignment2 6 0 input_test_5.txt output_test_6_scenario_22.txt
+
+echo "ran test scenario #22 ...."
+
+echo "output file \"output_test_6_scenario_22.txt\" was generated \n"
+
+#----------------------------------------------------------------
+
+echo "finished running test script #6 ...."
\ No newline at end of file
@@ -0,0 +1,57 @@
+
+# testing script testing first 3 testing input.txt files and input_test_5.txt
+# (input_test_5.txt has shorter processes arriving while a longer one runs (preemptions))
+
+# for testing the shortest remaining time first scheduler
+
+echo "running test script #7 .... \n"
+
+#----------------------------------------------------------------
+# testing scenario 23
+
+echo "running scenario #23 .... \n"
+
+./assignment2 7 0 input_test_1.txt output_test_7_scenario_23.txt
+
+echo "ran test scenario #23 ...."
+
+echo "output file \"output_test_7_scenario_23.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 24
+echo "running scenario #24 .... \n"
+
+./assignment2 7 0 input_test_2.txt output_test_7_scenario_24.txt
+
+echo "ran test scenario #24 ...."
+
+echo "output file \"output_test_7_scenario_24.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 25
+
+echo "running scenario #25 .... \n"
+
+./assignment2 7 0 input_test_3.txt output_test_7_scenario_25.txt
+
+echo "ran test scenario #25 ...."
+
+echo "output file \"output_test_7_scenario_25.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 26
+
+echo "running scenario #26 .... \n"
+
+./assignment2 7 0 input_test_5.txt output_test_7_scenario_26.txt
+
+echo "ran test scenario #26 ...."
+
+echo "output file \"output_test_7_scenario_26.txt\" was generated \n"
+
+#----------------------------------------------------------------
+
+echo "finished running test script #7 ...."
\ No newline at end of file
@@ -0,0 +1,57 @@
+
+# testing script testing first 3 testing input.txt files and input_test_5.txt
+# (input_test_5.txt has higher priority processes arriving while a lower priority one runs (preemptions))
+
+# for testing the preemptive Priority scheduler
+
+echo "running test script #8 .... \n"
+
+#----------------------------------------------------------------
+# testing scenario 27
+
+echo "running scenario #27 .... \n"
+
+./assignment2 8 0 input_test_1.txt output_test_8_scenario_27.txt
+
+echo "ran test scenario #27 ...."
+
+echo "output file \"output_test_8_scenario_27.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 28
+echo "running scenario #28 .... \n"
+
+./assignment2 8 0 input_test_2.txt output_test_8_scenario_28.txt
+
+echo "ran test scenario #28 ...."
+
+echo "output file \"output_test_8_scenario_28.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 29
+
+echo "running scenario #29 .... \n"
+
+./assignment2 8 0 input_test_3.txt output_test_8_scenario_29.txt
+
+echo "ran test scenario #29 ...."
+
+echo "output file \"output_test_8_scenario_29.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 30
+
+echo "running scenario #30 .... \n"
+
+./assignment2 8 0 input_test_5.txt output_test_8_scenario_30.txt
+
+echo "ran test scenario #30 ...."
+
+echo "output file \"output_test_8_scenario_30.txt\" was generated \n"
+
+#----------------------------------------------------------------
+
+echo "finished running test script #8 ...."
\ No newline at end of file
@@ -0,0 +1,57 @@
+
+# testing script testing first 3 testing input.txt files and input_test_5.txt
+# (input_test_5.txt has processes with earlier deadlines arriving while others run (preemptions) and a deadline miss)
+
+# for testing the earliest deadline first scheduler
+
+echo "running test script #9 .... \n"
+
+#----------------------------------------------------------------
+# testing scenario 31
+
+echo "running scenario #31 .... \n"
+
+./assignment2 9 0 input_test_1.txt output_test_9_scenario_31.txt
+
+echo "ran test scenario #31 ...."
+
+echo "output file \"output_test_9_scenario_31.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 32
+echo "running scenario #32 .... \n"
+
+./assignment2 9 0 input_test_2.txt output_test_9_scenario_32.txt
+
+echo "ran test scenario #32 ...."
+
+echo "output file \"output_test_9_scenario_32.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 33
+
+echo "running scenario #33 .... \n"
+
+./assignment2 9 0 input_test_3.txt output_test_9_scenario_33.txt
+
+echo "ran test scenario #33 ...."
+
+echo "output file \"output_test_9_scenario_33.txt\" was generated \n"
+
+
+#----------------------------------------------------------------
+# testing scenario 34
+
+echo "running scenario #34 .... \n"
+
+./assignment2 9 0 input_test_5.txt output_test_9_scenario_34.txt
+
+echo "ran test scenario #34 ...."
+
+echo "output file \"output_test_9_scenario_34.txt\" was generated \n"
+
+#----------------------------------------------------------------
+
+echo "finished running test script #9 ...."
\ No newline at end of file
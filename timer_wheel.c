@@ -0,0 +1,167 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "timer_wheel.h"
+
+//Initializing the timer wheel with no timers at tick 0.
+TimerWheel_t *initTimerWheel()
+{
+    //Allocating memory for the timer wheel on the heap, every slot starts empty.
+    TimerWheel_t *TimerWheel = (TimerWheel_t *)malloc(sizeof(TimerWheel_t));
+
+    memset(TimerWheel, 0, sizeof(TimerWheel_t));
+
+    return TimerWheel;
+}
+
+//Method to clean up the timer wheel (deallocates the memory on the heap of the wheel).
+//Parameter:- TimerWheel, a timer wheel.
+//Return:- N/A.
+void cleanTimerWheel(TimerWheel_t *TimerWheel)
+{
+    free(TimerWheel);
+}
+
+//Method that places a process on the slot its timer belongs to relative to the current tick of the wheel.
+//Parameter:- TimerWheel, a timer wheel.
+//Parameter:- process, a process with its timer_expiry set.
+//Return:- N/A.
+static void placeTimer(TimerWheel_t *TimerWheel, process_t *process)
+{
+    //the level is the highest group of bits in which the expiry and the current tick differ
+    unsigned long long difference = (unsigned long long)(process->timer_expiry ^ TimerWheel->now);
+    int level = 0;
+
+    if (difference != 0)
+    {
+        level = (63 - __builtin_clzll(difference)) / TIMER_WHEEL_BITS;
+    }
+
+    int slot = (int)((process->timer_expiry >> (level * TIMER_WHEEL_BITS)) & (TIMER_WHEEL_SLOTS - 1));
+
+    //adding the process to the front of the slot's list
+    process->timer_next = TimerWheel->slots[level][slot];
+    TimerWheel->slots[level][slot] = process;
+    TimerWheel->occupied[level] |= 1ULL << slot;
+}
+
+//Method for starting a timer for a process.
+//Parameter:- TimerWheel, a timer wheel.
+//Parameter:- process, the process the timer is for (it must not have another timer on the wheel).
+//Parameter:- expiry, the tick the timer expires on, not before the current tick of the wheel.
+//Return:- N/A.
+void scheduleTimer(TimerWheel_t *TimerWheel, process_t *process, long long expiry)
+{
+    //assertion: IO always ends after the current tick, so a timer that would have expired already is a bug and exits
+    if (expiry < TimerWheel->now)
+    {
+        perror("Error timer expires before the current tick of the timer wheel");
+        exit(-1);
+    }
+
+    process->timer_expiry = expiry;
+
+    placeTimer(TimerWheel, process);
+
+    TimerWheel->size++;
+}
+
+//Function that advances the wheel to a tick and removes the timers expiring on it.
+//The timers of the skipped ticks must have been collected already, i.e. time must not be later than
+//nextTimerExpiry (advancing one tick at a time always satisfies this).
+//Parameter:- TimerWheel, a timer wheel.
+//Parameter:- time, the tick to advance to.
+//Return:- the list (linked through timer_next) of processes whose timer expires on that tick, NULL if there are none.
+process_t *advanceTimerWheel(TimerWheel_t *TimerWheel, long long time)
+{
+    TimerWheel->now = time;
+
+    //cascading the slot the new tick falls into on every level, from the top down,
+    //its timers move to lower levels (and end up on level 0 if they expire on this tick)
+    for (int level = TIMER_WHEEL_LEVELS - 1; level > 0; level--)
+    {
+        int slot = (int)((time >> (level * TIMER_WHEEL_BITS)) & (TIMER_WHEEL_SLOTS - 1));
+
+        if (!(TimerWheel->occupied[level] & (1ULL << slot)))
+        {
+            continue;
+        }
+
+        process_t *process = TimerWheel->slots[level][slot];
+
+        TimerWheel->slots[level][slot] = NULL;
+        TimerWheel->occupied[level] &= ~(1ULL << slot);
+
+        while (process != NULL)
+        {
+            process_t *next = process->timer_next;
+
+            placeTimer(TimerWheel, process);
+
+            process = next;
+        }
+    }
+
+    //the level 0 slot of the tick holds exactly the timers expiring on it
+    int slot = (int)(time & (TIMER_WHEEL_SLOTS - 1));
+    process_t *expired = TimerWheel->slots[0][slot];
+
+    TimerWheel->slots[0][slot] = NULL;
+    TimerWheel->occupied[0] &= ~(1ULL << slot);
+
+    for (process_t *process = expired; process != NULL; process = process->timer_next)
+    {
+        TimerWheel->size--;
+    }
+
+    return expired;
+}
+
+//Function that returns the earliest tick a timer on the wheel expires on.
+//Timers on a lower level always expire before the ones on higher levels, so only the first non-empty slot of the
+//lowest non-empty level has to be looked at.
+//Parameter:- TimerWheel, a timer wheel.
+//Return:- the earliest expiry, -1 if there are no timers.
+long long nextTimerExpiry(TimerWheel_t *TimerWheel)
+{
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; level++)
+    {
+        if (TimerWheel->occupied[level] == 0)
+        {
+            continue;
+        }
+
+        int slot = __builtin_ctzll(TimerWheel->occupied[level]);
+
+        //a level 0 slot holds a single tick
+        if (level == 0)
+        {
+            return (TimerWheel->now & ~(long long)(TIMER_WHEEL_SLOTS - 1)) | slot;
+        }
+
+        //a higher slot covers a range of ticks, the earliest timer in it is searched for
+        long long earliest = -1;
+
+        for (process_t *process = TimerWheel->slots[level][slot]; process != NULL; process = process->timer_next)
+        {
+            if (earliest == -1 || process->timer_expiry < earliest)
+            {
+                earliest = process->timer_expiry;
+            }
+        }
+
+        return earliest;
+    }
+
+    return -1;
+}
+
+//function that returns the number of timers on the wheel
+//parameters a pointer to a timer wheel
+//returns the number of timers
+int getTimerCount(TimerWheel_t *TimerWheel)
+{
+    return TimerWheel->size;
+}
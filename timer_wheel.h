@@ -0,0 +1,46 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include "process.h"
+
+/* ======================================================
+ * TIMER WHEEL IMPLEMENTATION
+ * ======================================================
+ */
+
+//Each level of the wheel has 64 slots (6 bits of the expiry time), 11 levels cover every positive tick.
+#define TIMER_WHEEL_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_LEVELS 11
+
+//Hierarchical timer wheel of processes, keyed by the tick their timer expires on.
+//A timer is placed on the level of the highest group of 6 bits in which its expiry differs from the current
+//time, in the slot given by those 6 bits. Level 0 holds the timers expiring in the current 64 ticks, level 1
+//the ones in the current 4096 ticks, and so on. When the wheel advances, the one slot per level that the new
+//time falls into is cascaded down to the lower levels, so scheduling and expiring a timer are O(1) amortized
+//and only the processes whose timer expires are touched.
+//The timers are intrusive: a process holds its own expiry and link (timer_expiry, timer_next), so a process can
+//have one timer at a time and the wheel never allocates.
+typedef struct TimerWheel
+{
+    process_t *slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS]; // List of the processes with a timer in each slot.
+    unsigned long long occupied[TIMER_WHEEL_LEVELS];         // Bitmap of the non-empty slots on each level.
+    long long now;                                           // Tick the wheel has been advanced to.
+    int size;                                                // Number of timers on the wheel.
+} TimerWheel_t;
+
+//Constructing and clean up functions for the timer wheel.
+TimerWheel_t *initTimerWheel();
+void cleanTimerWheel(TimerWheel_t *TimerWheel);
+
+//Command for starting a timer for a process that expires on a given tick.
+void scheduleTimer(TimerWheel_t *TimerWheel, process_t *process, long long expiry);
+
+//Command for advancing the wheel to a tick, returns the list of processes whose timer expires on it.
+process_t *advanceTimerWheel(TimerWheel_t *TimerWheel, long long time);
+
+//Accessor methods for the earliest expiry and the number of timers.
+long long nextTimerExpiry(TimerWheel_t *TimerWheel);
+int getTimerCount(TimerWheel_t *TimerWheel);
+
+#endif //TIMER_WHEEL_H
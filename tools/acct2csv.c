@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "accounting.h"
+
+//Reader for accounting files (written with --accounting=FILE), prints every row as CSV.
+//The file is mapped into memory and every block is read column by column, the way an analysis tool would scan it.
+//
+//usage: acct2csv accounting_file [output_file]   (the CSV goes to standard output without an output file)
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2 || argc > 3)
+    {
+        fprintf(stderr, "usage: %s accounting_file [output_file]\n", argv[0]);
+        return 1;
+    }
+
+    int descriptor = open(argv[1], O_RDONLY);
+    struct stat status;
+
+    if (descriptor < 0 || fstat(descriptor, &status) != 0)
+    {
+        perror("Could not open file.");
+        return 1;
+    }
+
+    size_t length = (size_t)status.st_size;
+
+    if (length < sizeof(AccountingHeader_t))
+    {
+        fprintf(stderr, "%s: not an accounting file\n", argv[1]);
+        return 1;
+    }
+
+    const char *data = (const char *)mmap(NULL, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+    if (data == MAP_FAILED)
+    {
+        perror("Could not map file.");
+        return 1;
+    }
+
+    close(descriptor);
+
+    //checks that the file is an accounting file written with the same byte order
+    AccountingHeader_t header;
+
+    memcpy(&header, data, sizeof(header));
+
+    if (memcmp(header.magic, ACCOUNTING_MAGIC, sizeof(header.magic)) != 0)
+    {
+        fprintf(stderr, "%s: not an accounting file\n", argv[1]);
+        return 1;
+    }
+
+    if (header.version != ACCOUNTING_VERSION || header.block_rows <= 0)
+    {
+        fprintf(stderr, "%s: unsupported accounting version or byte order\n", argv[1]);
+        return 1;
+    }
+
+    FILE *output = argc == 3 ? fopen(argv[2], "w") : stdout;
+
+    if (output == NULL)
+    {
+        perror("Could not open file.");
+        return 1;
+    }
+
+    fprintf(output, "pid,arrival_time,first_run,finish,ready_wait,io_wait,dispatches,preemptions,partition_used\n");
+
+    size_t offset = sizeof(header);
+    long long left = header.rows;
+
+    //every block is the number of its rows followed by its columns
+    while (left > 0)
+    {
+        long long rows;
+
+        if (offset + sizeof(rows) > length)
+        {
+            fprintf(stderr, "%s: file is cut short\n", argv[1]);
+            return 1;
+        }
+
+        memcpy(&rows, data + offset, sizeof(rows));
+        offset += sizeof(rows);
+
+        if (rows <= 0 || rows > left || rows > header.block_rows || offset + (size_t)rows * getAccountingRowSize() > length)
+        {
+            fprintf(stderr, "%s: file is cut short\n", argv[1]);
+            return 1;
+        }
+
+        //the columns of the block, one after the other
+        const int *pid = (const int *)(data + offset);
+        const int *arrival_time = pid + rows;
+        const long long *first_run = (const long long *)(arrival_time + rows);
+        const long long *finish = first_run + rows;
+        const long long *ready_wait = finish + rows;
+        const long long *io_wait = ready_wait + rows;
+        const int *dispatches = (const int *)(io_wait + rows);
+        const int *preemptions = dispatches + rows;
+        const int *partition_used = preemptions + rows;
+
+        for (long long i = 0; i < rows; i++)
+        {
+            fprintf(output, "%d,%d,%lld,%lld,%lld,%lld,%d,%d,%d\n", pid[i], arrival_time[i], first_run[i], finish[i],
+                    ready_wait[i], io_wait[i], dispatches[i], preemptions[i], partition_used[i]);
+        }
+
+        offset += (size_t)rows * getAccountingRowSize();
+        left -= rows;
+    }
+
+    if (output != stdout)
+    {
+        fclose(output);
+    }
+
+    munmap((void *)data, length);
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace.h"
+
+//Converter from a binary trace (written with --trace=binary) to the text output file the simulator writes by default.
+//The records are read in large blocks and written through the same functions the simulator prints with, so the
+//text is identical to a run with --trace=text.
+//
+//usage: trace2text binary_trace [output_file]   (the text goes to standard output without an output file)
+
+//number of records read from the binary trace at once
+#define RECORDS_PER_READ 65536
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2 || argc > 3)
+    {
+        fprintf(stderr, "usage: %s binary_trace [output_file]\n", argv[0]);
+        return 1;
+    }
+
+    FILE *input = fopen(argv[1], "rb");
+
+    if (input == NULL)
+    {
+        perror("Could not open file.");
+        return 1;
+    }
+
+    //checks that the file is a binary trace written by a simulator with the same record layout and byte order
+    TraceRecord_t header;
+
+    if (fread(&header, sizeof(header), 1, input) != 1 ||
+        memcmp(header.header.magic, TRACE_MAGIC, sizeof(header.header.magic)) != 0)
+    {
+        fprintf(stderr, "%s: not a binary trace\n", argv[1]);
+        return 1;
+    }
+
+    if (header.header.version != TRACE_VERSION || header.header.record_size != (int)sizeof(TraceRecord_t))
+    {
+        fprintf(stderr, "%s: unsupported trace version or byte order\n", argv[1]);
+        return 1;
+    }
+
+    Trace_t *output = outputFileInit(argc == 3 ? argv[2] : "/dev/stdout", TRACE_TEXT);
+
+    if (output == NULL)
+    {
+        perror(argc == 3 ? argv[2] : "/dev/stdout");
+        return 1;
+    }
+
+    TraceRecord_t *records = (TraceRecord_t *)malloc(sizeof(TraceRecord_t) * RECORDS_PER_READ);
+    size_t count;
+
+    //number of the records read before this block (the header is record 0), for errors
+    long long recordsRead = 1;
+
+    //partitions of the memory information being put back together from its two records
+    int partitions[NUMBER_OF_PARTITIONS][2];
+
+    while ((count = fread(records, sizeof(TraceRecord_t), RECORDS_PER_READ, input)) > 0)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            TraceRecord_t *record = &records[i];
+            long long recordNumber = recordsRead + (long long)i;
+
+            if (record->transition.type == TRACE_RECORD_TRANSITION)
+            {
+                //a corrupt record could name a state that does not exist
+                if (record->transition.prev_state > TERMINATED || record->transition.new_state > TERMINATED)
+                {
+                    fprintf(stderr, "%s: record %lld (offset %lld): unknown state %d or %d\n", argv[1], recordNumber,
+                            recordNumber * (long long)sizeof(TraceRecord_t), record->transition.prev_state,
+                            record->transition.new_state);
+                    return 1;
+                }
+
+                printTransition(output, record->transition.clock, record->transition.pid,
+                                (States)record->transition.prev_state, (States)record->transition.new_state);
+            }
+            else if (record->memory.type == TRACE_RECORD_MEMORY)
+            {
+                if (record->memory.half > 1)
+                {
+                    fprintf(stderr, "%s: record %lld (offset %lld): unknown memory half %d\n", argv[1], recordNumber,
+                            recordNumber * (long long)sizeof(TraceRecord_t), record->memory.half);
+                    return 1;
+                }
+
+                int first = 2 * record->memory.half;
+
+                for (int j = 0; j < NUMBER_OF_PARTITIONS; j++)
+                {
+                    partitions[j][1] = (record->memory.availability & (1 << j)) ? -1 : 1;
+                }
+
+                partitions[first][0] = record->memory.remaining[0];
+                partitions[first + 1][0] = record->memory.remaining[1];
+
+                //the information is printed once both halves have been read
+                if (record->memory.half == 1)
+                {
+                    print_memory_information(output, partitions, record->memory.memory_scheme);
+                }
+            }
+            else
+            {
+                fprintf(stderr, "%s: record %lld (offset %lld): unknown record type %d\n", argv[1], recordNumber,
+                        recordNumber * (long long)sizeof(TraceRecord_t), record->transition.type);
+                return 1;
+            }
+        }
+
+        recordsRead += (long long)count;
+    }
+
+    free(records);
+    fclose(input);
+
+    //the text is written by the writer thread, a write that failed is only known once it is done
+    int error = finishOutputFile(output);
+
+    cleanOutputFile(output);
+
+    if (error != 0)
+    {
+        fprintf(stderr, "%s: %s\n", argc == 3 ? argv[2] : "/dev/stdout", strerror(error));
+        return 1;
+    }
+
+    return 0;
+}
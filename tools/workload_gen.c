@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "workload.h"
+
+//Generator of synthetic input files, seeded so the same options always generate the same file.
+//Arrivals are a Poisson process, CPU times are exponential or heavy-tailed (Pareto), the I/O frequency, I/O duration,
+//priority, memory needed and relative deadline are uniform over their ranges.
+//
+//usage: workload_gen [options] processes [output_file]   (the processes go to standard output without an output file)
+//
+//options: --seed=N, --rate=ARRIVALS_PER_TICK, --cpu=exp:MEAN or --cpu=pareto:SCALE:SHAPE, --cpu-max=N,
+//         --io-frequency=MIN:MAX, --io-duration=MIN:MAX, --priority=MIN:MAX, --memory=MIN:MAX or --memory=none,
+//         --deadline=MIN:MAX (no deadline column by default)
+
+//method that exits with the usage of the generator
+static void usage(const char *program)
+{
+    fprintf(stderr, "usage: %s [--seed=N] [--rate=R] [--cpu=exp:MEAN|pareto:SCALE:SHAPE] [--cpu-max=N] "
+                    "[--io-frequency=MIN:MAX] [--io-duration=MIN:MAX] [--priority=MIN:MAX] [--memory=MIN:MAX|none] "
+                    "[--deadline=MIN:MAX] processes [output_file]\n", program);
+    exit(1);
+}
+
+//method that reads a MIN:MAX range given to an option, exits if it is not one
+static void parseRange(const char *program, const char *text, int *min, int *max)
+{
+    if (sscanf(text, "%d:%d", min, max) != 2 || *min > *max)
+    {
+        usage(program);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    WorkloadParameters_t parameters;
+
+    defaultWorkloadParameters(&parameters);
+
+    const char *positional[2];
+    int positionalCount = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--seed=", 7) == 0)
+        {
+            parameters.seed = strtoull(argv[i] + 7, NULL, 10);
+        }
+        else if (strncmp(argv[i], "--rate=", 7) == 0)
+        {
+            parameters.arrival_rate = atof(argv[i] + 7);
+
+            if (parameters.arrival_rate <= 0)
+            {
+                usage(argv[0]);
+            }
+        }
+        else if (strncmp(argv[i], "--cpu=exp:", 10) == 0)
+        {
+            parameters.cpu_distribution = CPU_EXPONENTIAL;
+            parameters.cpu_mean = atof(argv[i] + 10);
+        }
+        else if (strncmp(argv[i], "--cpu=pareto:", 13) == 0)
+        {
+            parameters.cpu_distribution = CPU_PARETO;
+
+            if (sscanf(argv[i] + 13, "%lf:%lf", &parameters.cpu_scale, &parameters.cpu_shape) != 2 || parameters.cpu_shape <= 0)
+            {
+                usage(argv[0]);
+            }
+        }
+        else if (strncmp(argv[i], "--cpu-max=", 10) == 0)
+        {
+            parameters.cpu_max = atoi(argv[i] + 10);
+        }
+        else if (strncmp(argv[i], "--io-frequency=", 15) == 0)
+        {
+            parseRange(argv[0], argv[i] + 15, &parameters.io_frequency_min, &parameters.io_frequency_max);
+        }
+        else if (strncmp(argv[i], "--io-duration=", 14) == 0)
+        {
+            parseRange(argv[0], argv[i] + 14, &parameters.io_duration_min, &parameters.io_duration_max);
+        }
+        else if (strncmp(argv[i], "--priority=", 11) == 0)
+        {
+            parseRange(argv[0], argv[i] + 11, &parameters.priority_min, &parameters.priority_max);
+        }
+        else if (strcmp(argv[i], "--memory=none") == 0)
+        {
+            parameters.memory_min = 0;
+            parameters.memory_max = 0;
+        }
+        else if (strncmp(argv[i], "--memory=", 9) == 0)
+        {
+            parseRange(argv[0], argv[i] + 9, &parameters.memory_min, &parameters.memory_max);
+        }
+        else if (strncmp(argv[i], "--deadline=", 11) == 0)
+        {
+            parseRange(argv[0], argv[i] + 11, &parameters.deadline_min, &parameters.deadline_max);
+
+            //a deadline of 0 means none
+            if (parameters.deadline_min < 1)
+            {
+                usage(argv[0]);
+            }
+        }
+        else if (strncmp(argv[i], "--", 2) == 0 || positionalCount == 2)
+        {
+            usage(argv[0]);
+        }
+        else
+        {
+            positional[positionalCount++] = argv[i];
+        }
+    }
+
+    if (positionalCount == 0)
+    {
+        usage(argv[0]);
+    }
+
+    long long numberOfProcesses = atoll(positional[0]);
+    FILE *file = stdout;
+
+    if (positionalCount == 2)
+    {
+        file = fopen(positional[1], "w");
+
+        if (file == NULL)
+        {
+            perror("Could not create file.");
+            return 1;
+        }
+    }
+
+    generateWorkload(file, numberOfProcesses, &parameters);
+
+    if (file != stdout)
+    {
+        fclose(file);
+    }
+
+    return 0;
+}
@@ -0,0 +1,429 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <sched.h>
+#include <time.h>
+#include <errno.h>
+
+#include "trace.h"
+
+//Longest text a transition line can take (two 20 digit numbers, two state names and the spaces)
+#define TRANSITION_TEXT_SIZE 80
+
+//Longest text a memory information block can take
+#define MEMORY_TEXT_SIZE 1024
+
+//Function run by the writer thread: writes the full buffers to the output file in order until the trace is closed
+//once a write fails the error is kept for the simulation and the buffers are still taken (without being written), so
+//the simulation never waits on a writer that can not write
+//parameters are the trace
+//returns nothing
+static void *writeTrace(void *argument)
+{
+    Trace_t *trace = (Trace_t *)argument;
+    size_t consumed = atomic_load_explicit(&trace->consumed, memory_order_relaxed);
+
+    while (true)
+    {
+        size_t produced = atomic_load_explicit(&trace->produced, memory_order_acquire);
+
+        //no full buffer, sleeps a little before looking again (stops once the last buffer has been written)
+        if (consumed == produced)
+        {
+            if (atomic_load_explicit(&trace->closing, memory_order_acquire) &&
+                consumed == atomic_load_explicit(&trace->produced, memory_order_acquire))
+            {
+                break;
+            }
+
+            struct timespec pause = {0, 100000};
+            nanosleep(&pause, NULL);
+
+            continue;
+        }
+
+        int slot = (int)(consumed % TRACE_BUFFERS);
+
+        if (atomic_load_explicit(&trace->write_error, memory_order_relaxed) == 0 &&
+            fwrite(trace->buffers[slot], 1, trace->lengths[slot], trace->file) != trace->lengths[slot])
+        {
+            atomic_store_explicit(&trace->write_error, errno != 0 ? errno : EIO, memory_order_relaxed);
+        }
+
+        //gives the buffer back to the simulation
+        atomic_store_explicit(&trace->consumed, ++consumed, memory_order_release);
+    }
+
+    return NULL;
+}
+
+//Method that hands the buffer being filled to the writer thread and moves on to the next buffer of the ring
+//parameters are the trace
+//returns nothing
+static void flushTrace(Trace_t *trace)
+{
+    if (trace->used == 0)
+    {
+        return;
+    }
+
+    STAT_START_EVERY(&trace->flushes, flush);
+
+    size_t produced = atomic_load_explicit(&trace->produced, memory_order_relaxed);
+
+    trace->lengths[produced % TRACE_BUFFERS] = trace->used;
+    atomic_store_explicit(&trace->produced, ++produced, memory_order_release);
+
+    //waits for the writer only if it has not written the next buffer yet (every buffer is full)
+    while (produced - atomic_load_explicit(&trace->consumed, memory_order_acquire) == TRACE_BUFFERS)
+    {
+        sched_yield();
+    }
+
+    trace->buffer = trace->buffers[produced % TRACE_BUFFERS];
+    trace->used = 0;
+
+    //a write of the writer that failed is seen by the simulation on the next buffer it hands over
+    if (trace->error == 0)
+    {
+        trace->error = atomic_load_explicit(&trace->write_error, memory_order_relaxed);
+    }
+
+    STAT_STOP_EVERY(&trace->flushes, flush);
+}
+
+//Function that makes room in the buffer for some bytes, writing the buffer to the file if it is too full
+//parameters are the trace and the number of bytes
+//returns a pointer to where the bytes go in the buffer
+static char *reserveTrace(Trace_t *trace, size_t bytes)
+{
+    if (trace->used + bytes > trace->capacity)
+    {
+        flushTrace(trace);
+    }
+
+    return trace->buffer + trace->used;
+}
+
+//Method that writes a binary record to the buffer
+//parameters are the trace and the record
+//returns nothing
+static void writeRecord(Trace_t *trace, const TraceRecord_t *record)
+{
+    memcpy(reserveTrace(trace, sizeof(TraceRecord_t)), record, sizeof(TraceRecord_t));
+    trace->used += sizeof(TraceRecord_t);
+}
+
+//Function that writes a number in decimal
+//parameters are where to write it and the number
+//returns a pointer past the last digit
+static char *writeNumber(char *out, long long number)
+{
+    char digits[24];
+    int count = 0;
+
+    //the digits are worked out from the last one, negating one digit at a time so the lowest number works too
+    unsigned long long value = number < 0 ? 0ULL - (unsigned long long)number : (unsigned long long)number;
+
+    do
+    {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    if (number < 0)
+    {
+        *out++ = '-';
+    }
+
+    while (count > 0)
+    {
+        *out++ = digits[--count];
+    }
+
+    return out;
+}
+
+//Function that writes a string without its terminating character
+//parameters are where to write it and the string
+//returns a pointer past the last character
+static char *writeString(char *out, const char *string)
+{
+    size_t length = strlen(string);
+
+    memcpy(out, string, length);
+
+    return out + length;
+}
+
+Trace_t *outputFileInit(const char *outputFile, TraceFormats format)
+{
+    Trace_t *trace = (Trace_t *)malloc(sizeof(Trace_t));
+
+    trace->format = format;
+    trace->file = NULL;
+    trace->buffer = NULL;
+    trace->used = 0;
+    trace->capacity = 0;
+    trace->error = 0;
+
+    memset(trace->buffers, 0, sizeof(trace->buffers));
+    atomic_init(&trace->produced, 0);
+    atomic_init(&trace->consumed, 0);
+    atomic_init(&trace->closing, false);
+    atomic_init(&trace->write_error, 0);
+
+#ifdef SCHEDULER_STATS
+    memset(&trace->flushes, 0, sizeof(trace->flushes));
+#endif
+
+    if (format == TRACE_NONE)
+    {
+        return trace;
+    }
+
+    trace->file = fopen(outputFile, format == TRACE_BINARY ? "wb" : "w"); // opens file in current working directory in write mode
+                                                                          // if the file does not exist, it will create the file
+
+    if (trace->file == NULL)
+    { //Check if file opened properly, errno says why it did not
+        free(trace);
+
+        return NULL;
+    }
+
+    //the output is collected in a large buffer and written in one block, the file does not need its own buffer
+    setvbuf(trace->file, NULL, _IONBF, 0);
+
+    trace->capacity = TRACE_BUFFER_SIZE;
+
+    for (int i = 0; i < TRACE_BUFFERS; i++)
+    {
+        trace->buffers[i] = (char *)malloc(trace->capacity);
+    }
+
+    trace->buffer = trace->buffers[0];
+
+    //starts the thread that writes the full buffers to the file, errno says why it could not be started
+    int started = pthread_create(&trace->writer, NULL, writeTrace, trace);
+
+    if (started != 0)
+    {
+        fclose(trace->file);
+
+        for (int i = 0; i < TRACE_BUFFERS; i++)
+        {
+            free(trace->buffers[i]);
+        }
+
+        free(trace);
+        errno = started;
+
+        return NULL;
+    }
+
+    //a binary trace starts with a header record
+    if (format == TRACE_BINARY)
+    {
+        TraceRecord_t header;
+
+        memset(&header, 0, sizeof(header));
+        memcpy(header.header.magic, TRACE_MAGIC, sizeof(header.header.magic));
+        header.header.version = TRACE_VERSION;
+        header.header.record_size = (int)sizeof(TraceRecord_t);
+
+        writeRecord(trace, &header);
+    }
+
+    //returns the output trace
+    return trace;
+}
+
+int finishOutputFile(Trace_t *trace)
+{
+    //hands over what is left, waits for the writer to write everything and closes the output file
+    if (trace->file != NULL)
+    {
+        flushTrace(trace);
+
+        atomic_store_explicit(&trace->closing, true, memory_order_release);
+        pthread_join(trace->writer, NULL);
+
+        if (trace->error == 0)
+        {
+            trace->error = atomic_load_explicit(&trace->write_error, memory_order_relaxed);
+        }
+
+        if (fclose(trace->file) != 0 && trace->error == 0)
+        {
+            trace->error = errno;
+        }
+
+        trace->file = NULL;
+    }
+
+    return trace->error;
+}
+
+void cleanOutputFile(Trace_t *trace)
+{
+    finishOutputFile(trace);
+
+    for (int i = 0; i < TRACE_BUFFERS; i++)
+    {
+        free(trace->buffers[i]);
+    }
+
+    free(trace);
+}
+
+void printTransition(Trace_t *trace, long long clock, int pid, States prevState, States newState)
+{
+    if (trace->format == TRACE_TEXT)
+    {
+        //formats " clock pid PREVSTATE NEWSTATE \n" straight into the buffer
+        char *out = reserveTrace(trace, TRANSITION_TEXT_SIZE);
+        char *start = out;
+
+        *out++ = ' ';
+        out = writeNumber(out, clock);
+        *out++ = ' ';
+        out = writeNumber(out, pid);
+        *out++ = ' ';
+        out = writeString(out, getStringFromState(prevState));
+        *out++ = ' ';
+        out = writeString(out, getStringFromState(newState));
+        *out++ = ' ';
+        *out++ = '\n';
+
+        trace->used += out - start;
+    }
+    else if (trace->format == TRACE_BINARY)
+    {
+        TraceRecord_t record;
+
+        record.transition.clock = clock;
+        record.transition.pid = pid;
+        record.transition.prev_state = (unsigned char)prevState;
+        record.transition.new_state = (unsigned char)newState;
+        record.transition.type = TRACE_RECORD_TRANSITION;
+        record.transition.unused = 0;
+
+        writeRecord(trace, &record);
+    }
+}
+
+void print_memory_information(Trace_t *trace, int partitions[][2], int memory_scheme)
+{
+    if (trace->format == TRACE_BINARY)
+    {
+        unsigned char availability = 0;
+
+        for (int i = 0; i < NUMBER_OF_PARTITIONS; i++)
+        {
+            if (partitions[i][1] == -1)
+            {
+                availability |= (unsigned char)(1 << i);
+            }
+        }
+
+        //two records, each with the remaining space of two partitions
+        for (int half = 0; half < 2; half++)
+        {
+            TraceRecord_t record;
+
+            memset(&record, 0, sizeof(record));
+            record.memory.remaining[0] = partitions[2 * half][0];
+            record.memory.remaining[1] = partitions[2 * half + 1][0];
+            record.memory.availability = availability;
+            record.memory.memory_scheme = (unsigned char)memory_scheme;
+            record.memory.type = TRACE_RECORD_MEMORY;
+            record.memory.half = (unsigned char)half;
+
+            writeRecord(trace, &record);
+        }
+
+        return;
+    }
+
+    if (trace->format != TRACE_TEXT)
+    {
+        return;
+    }
+
+    //
+    //  **********************
+    //  Total Memory Used: %d MB | Free Memory Available: %d MB | Usable Memory: MB
+    //
+    //  Partitions Available: 
+    //  Partition 1 (%d MB) Available? Yes/No
+    //  Partition 2 (%d MB) Available? Yes/No
+    //  Partition 3 (%d MB) Available? Yes/No
+    //  Partition 4 (%d MB) Available? Yes/No
+    //  ***************************
+    //
+
+    //sizes of the partitions of the memory scheme
+    const int (*sizes)[2] = memory_scheme == 1 ? MEMORY_SCHEME_1 : MEMORY_SCHEME_2;
+
+    //variable for calculating the amount of free memory available
+    int total_free_memory_available = 0;
+
+    //variable for calculating the amount of usable memory available
+    int total_usable_memory_available = 0;
+
+    //variable for calculating the amount of used memory
+    int memory_used = 0;
+
+    //for loop that iterates through the partitions
+    for (int i = 0; i < NUMBER_OF_PARTITIONS; i++)
+    {
+        //adds the remaining space in each partition to total_free_memory_available
+        total_free_memory_available += partitions[i][0];
+
+        //adds the memory used by calculating the difference between the capacity of each partition and 
+        //the current remaining space (depends on the memory portions assigned)
+        memory_used += (sizes[i][0] - partitions[i][0]);
+
+        //adds the remaining space in each availble partition to total_usable_memory_available
+        //after checking if the partition is currently usable
+        if(partitions[i][1] == -1){
+            total_usable_memory_available += partitions[i][0];
+        }
+    }
+
+    //formats the information into the buffer
+    char *out = reserveTrace(trace, MEMORY_TEXT_SIZE);
+    size_t left = trace->capacity - trace->used;
+    int length = 0;
+
+    length += snprintf(out + length, left - length, "\n************************ \n");
+
+    length += snprintf(out + length, left - length, "Total Memory Used: %d MB | Free Memory Available: %d MB | Usable Memory: %d MB \n", memory_used, total_free_memory_available, total_usable_memory_available);
+
+    length += snprintf(out + length, left - length, "Partitions Available: \n");
+
+    //for loop that iterates through all the partions
+    for(int i = 0; i < NUMBER_OF_PARTITIONS ; i++){
+
+        //prints out the availablitiy information of the partition ("Yes" if the partion is available and "No" if not)
+        length += snprintf(out + length, left - length, "Partition %d  %d MB/(%d MB) Available? %s \n", i , partitions[i][0] , sizes[i][0], partitions[i][1] == -1 ? "Yes" : "No");
+    }
+
+    length += snprintf(out + length, left - length, "************************ \n\n");
+
+    trace->used += length;
+}
+
+//function for getting the string equivalent of a States Enum
+//parameter is an a State Enum (NEW to TERMINATED, a value read from a file has to be checked first)
+//returns a string
+const char *getStringFromState(States state)
+{
+    //array of strings corresponding to the Process State Enum s
+    static const char *states[] = {"NEW", "READY", "RUNNING", "WAITING", "TERMINATED"};
+
+    //returns string of the state enum
+    return states[state];
+}
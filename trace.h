@@ -0,0 +1,119 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "process.h"
+#include "memory_schemes.h"
+#include "stats.h"
+
+/* ======================================================
+ * OUTPUT TRACE IMPLEMENTATION
+ * ======================================================
+ */
+
+//The formats the transitions and memory information can be written in
+typedef enum Trace_Format
+{
+    TRACE_TEXT,   // The text lines of the output file (" clock pid PREVSTATE NEWSTATE \n" and the memory blocks)
+    TRACE_BINARY, // Fixed size binary records, converted back to the text lines by trace2text
+    TRACE_NONE    // Nothing is written
+} TraceFormats;
+
+//Size of the buffers the output is collected in before it is written to the file, and number of buffers
+#define TRACE_BUFFER_SIZE (1 << 20)
+#define TRACE_BUFFERS 4
+
+//Kinds of binary records
+#define TRACE_RECORD_TRANSITION 0
+#define TRACE_RECORD_MEMORY 1
+
+//First 8 bytes and version of a binary trace
+#define TRACE_MAGIC "SCHTRACE"
+#define TRACE_VERSION 1
+
+//A binary trace is a header record followed by 16 byte records, in the order the text lines would be written.
+//A transition is one record. The memory information is two records, half 0 with partitions 0 and 1 and half 1 with
+//partitions 2 and 3, both with the availability of every partition and the memory scheme (the sizes of the
+//partitions come from the scheme).
+//Records are written in the byte order of the machine, the header's version tells the reader if it matches.
+typedef union TraceRecord
+{
+    struct
+    {
+        char magic[8];    // TRACE_MAGIC.
+        int version;      // TRACE_VERSION, also tells the byte order.
+        int record_size;  // sizeof(TraceRecord_t).
+    } header;
+
+    struct
+    {
+        long long clock;          // Tick of the transition.
+        int pid;                  // Process ID.
+        unsigned char prev_state; // State before the transition.
+        unsigned char new_state;  // State after the transition.
+        unsigned char type;       // TRACE_RECORD_TRANSITION.
+        unsigned char unused;
+    } transition;
+
+    struct
+    {
+        int remaining[2];           // Remaining space of the two partitions of this half.
+        int unused;
+        unsigned char availability; // Bit i is set if partition i is available.
+        unsigned char memory_scheme; // Memory scheme in use (1 or 2).
+        unsigned char type;         // TRACE_RECORD_MEMORY.
+        unsigned char half;         // 0 for partitions 0 and 1, 1 for partitions 2 and 3.
+    } memory;
+} TraceRecord_t;
+
+//The output file and the buffers the output is collected in.
+//The simulation fills one buffer at a time, and a writer thread writes the full buffers to the file in large blocks
+//so the simulation never waits on the disk. The buffers are handed over through a single-producer single-consumer
+//ring: buffer (produced % TRACE_BUFFERS) is the one being filled, the ones from consumed to produced are full and
+//waiting for the writer. Each side only moves its own counter, so no lock is taken, the simulation only waits if
+//every buffer is full (the disk is slower than the simulation).
+typedef struct Trace
+{
+    FILE *file;                       // Output file, NULL with TRACE_NONE.
+    TraceFormats format;              // Format of the output.
+    char *buffers[TRACE_BUFFERS];     // Ring of buffers.
+    size_t lengths[TRACE_BUFFERS];    // Number of bytes in each full buffer.
+    char *buffer;                     // Buffer being filled.
+    size_t used;                      // Number of bytes in the buffer being filled.
+    size_t capacity;                  // Size of a buffer.
+    atomic_size_t produced;           // Number of buffers handed to the writer (only moved by the simulation).
+    atomic_size_t consumed;           // Number of buffers written to the file (only moved by the writer).
+    atomic_bool closing;              // Set when no more buffers will be handed over.
+    atomic_int write_error;           // errno of the first write of the writer that failed, 0 if none has.
+    int error;                        // The write error as seen by the simulation (once it hands over a buffer).
+    pthread_t writer;                 // Writer thread.
+#ifdef SCHEDULER_STATS
+    StatCounter_t flushes;            // Buffers handed to the writer and the time spent handing them (--stats).
+#endif
+} Trace_t;
+
+//Opens the output file for a format (TRACE_NONE opens nothing), returns NULL (errno says why) if the file can not be
+//opened or its writer thread can not be started.
+Trace_t *outputFileInit(const char *outputFile, TraceFormats format);
+
+//Writes what is left in the buffer and closes the output file (nothing is written after), returns 0 if everything
+//was written and the errno of the first failure otherwise. Closing it again returns the same.
+int finishOutputFile(Trace_t *trace);
+
+//Closes the output file if it is still open and frees the trace.
+void cleanOutputFile(Trace_t *trace);
+
+//Writes a transition in the state of a process.
+void printTransition(Trace_t *trace, long long clock, int pid, States prevState, States newState);
+
+//Writes the usage and availability of the partitions of a memory scheme.
+void print_memory_information(Trace_t *trace, int partitions[][2], int memory_scheme);
+
+//Returns the string equivalent of a state.
+const char *getStringFromState(States state);
+
+#endif //TRACE_H
@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <math.h>
+
+#include "workload.h"
+
+//Method that sets the parameters of a workload to the defaults.
+//Parameter:- parameters, the parameters to set.
+//Return:- N/A.
+void defaultWorkloadParameters(WorkloadParameters_t *parameters)
+{
+    parameters->seed = 1;
+    parameters->arrival_rate = 0.04;
+    parameters->cpu_distribution = CPU_EXPONENTIAL;
+    parameters->cpu_mean = 20.0;
+    parameters->cpu_scale = 5.0;
+    parameters->cpu_shape = 1.5;
+    parameters->cpu_max = 10000;
+    parameters->io_frequency_min = 1;
+    parameters->io_frequency_max = 100;
+    parameters->io_duration_min = 1;
+    parameters->io_duration_max = 50;
+    parameters->priority_min = 0;
+    parameters->priority_max = 9;
+    parameters->memory_min = 1;
+    parameters->memory_max = 300;
+    parameters->deadline_min = 0;
+    parameters->deadline_max = 0;
+}
+
+//Function that returns the next number of a splitmix64 random number generator.
+//Parameter:- state, the state of the generator, advanced.
+//Return:- a random 64 bit number.
+static unsigned long long nextRandom(unsigned long long *state)
+{
+    unsigned long long z = (*state += 0x9E3779B97F4A7C15ull);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+
+    return z ^ (z >> 31);
+}
+
+//Function that returns a random number in [0, 1).
+//Parameter:- state, the state of the generator.
+//Return:- the number.
+static double uniform(unsigned long long *state)
+{
+    return (double)(nextRandom(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+//Function that returns a random whole number between min and max (both included).
+//Parameter:- state, the state of the generator.
+//Parameter:- min and max, the range.
+//Return:- the number.
+static int uniformRange(unsigned long long *state, int min, int max)
+{
+    if (max <= min)
+    {
+        return min;
+    }
+
+    return min + (int)(nextRandom(state) % (unsigned long long)(max - min + 1));
+}
+
+//Function that draws the total CPU time of a process.
+//Parameter:- state, the state of the generator.
+//Parameter:- parameters, the parameters of the workload.
+//Return:- the CPU time, between 1 and cpu_max ticks.
+static int cpuTime(unsigned long long *state, const WorkloadParameters_t *parameters)
+{
+    double time;
+
+    //inverse transform sampling, 1 - u is never 0
+    if (parameters->cpu_distribution == CPU_PARETO)
+    {
+        time = parameters->cpu_scale / pow(1.0 - uniform(state), 1.0 / parameters->cpu_shape);
+    }
+    else
+    {
+        time = -parameters->cpu_mean * log(1.0 - uniform(state));
+    }
+
+    if (time < 1.0)
+    {
+        return 1;
+    }
+
+    if (time > parameters->cpu_max)
+    {
+        return parameters->cpu_max;
+    }
+
+    return (int)(time + 0.5);
+}
+
+//Method that writes a generated workload in the input file format.
+//Parameter:- file, the file the processes are written to.
+//Parameter:- numberOfProcesses, the number of processes.
+//Parameter:- parameters, the parameters of the workload.
+//Return:- N/A.
+void generateWorkload(FILE *file, long long numberOfProcesses, const WorkloadParameters_t *parameters)
+{
+    unsigned long long state = parameters->seed;
+
+    //time of the last arrival, the gaps between Poisson arrivals are exponential
+    double time = 0.0;
+
+    for (long long i = 0; i < numberOfProcesses; i++)
+    {
+        if (i > 0)
+        {
+            time += -log(1.0 - uniform(&state)) / parameters->arrival_rate;
+        }
+
+        if (time > INT_MAX)
+        {
+            fprintf(stderr, "arrival times no longer fit in the input file after %lld processes, raise the arrival rate\n", i);
+            exit(-1);
+        }
+
+        int cpu = cpuTime(&state, parameters);
+        int io_frequency = uniformRange(&state, parameters->io_frequency_min, parameters->io_frequency_max);
+        int io_duration = uniformRange(&state, parameters->io_duration_min, parameters->io_duration_max);
+        int priority = uniformRange(&state, parameters->priority_min, parameters->priority_max);
+
+        fprintf(file, "%lld %d %d %d %d %d", i + 1, (int)time, cpu, io_frequency, io_duration, priority);
+
+        //the memory needed is only written when it is generated, or as 0 when a deadline comes after it
+        if (parameters->memory_max > 0)
+        {
+            fprintf(file, " %d", uniformRange(&state, parameters->memory_min, parameters->memory_max));
+        }
+        else if (parameters->deadline_max > 0)
+        {
+            fprintf(file, " 0");
+        }
+
+        //the relative deadline is only written when it is generated
+        if (parameters->deadline_max > 0)
+        {
+            fprintf(file, " %d", uniformRange(&state, parameters->deadline_min, parameters->deadline_max));
+        }
+
+        fputc('\n', file);
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include <stdio.h>
+
+/* ======================================================
+ * SYNTHETIC WORKLOAD GENERATOR
+ * ======================================================
+ */
+
+//The distributions the CPU time of a generated process can be drawn from
+typedef enum CPU_Distribution
+{
+    CPU_EXPONENTIAL, // Exponential with mean cpu_mean
+    CPU_PARETO       // Heavy-tailed Pareto with scale cpu_scale and shape cpu_shape (mean scale*shape/(shape-1))
+} CPU_Distributions;
+
+//Parameters of a generated workload, the same seed and parameters always generate the same file
+typedef struct WorkloadParameters
+{
+    unsigned long long seed;            // Seed of the random number generator.
+    double arrival_rate;                // Mean number of arrivals per tick (Poisson arrivals).
+    CPU_Distributions cpu_distribution; // Distribution of the total CPU time.
+    double cpu_mean;                    // Mean CPU time of the exponential distribution.
+    double cpu_scale;                   // Smallest CPU time of the Pareto distribution.
+    double cpu_shape;                   // Shape of the Pareto distribution, the tail is heavier the closer it is to 1.
+    int cpu_max;                        // CPU times are capped at this many ticks.
+    int io_frequency_min;               // Range of the I/O frequency (uniform).
+    int io_frequency_max;
+    int io_duration_min;                // Range of the I/O duration (uniform).
+    int io_duration_max;
+    int priority_min;                   // Range of the priority (uniform).
+    int priority_max;
+    int memory_min;                     // Range of the memory needed (uniform), the column is left out if memory_max
+    int memory_max;                     // is 0 (only usable without a memory scheme).
+    int deadline_min;                   // Range of the deadline relative to the arrival (uniform), the column is left
+    int deadline_max;                   // out if deadline_max is 0 (the default).
+} WorkloadParameters_t;
+
+//Sets the parameters to the defaults: seed 1, 0.04 arrivals per tick (the CPU is busy 80% of the time), exponential
+//CPU times with mean 20 (capped at 10000), I/O every 1-100 ticks for 1-50 ticks, priorities 0-9 and 1-300 MB of
+//memory (fits both memory schemes).
+void defaultWorkloadParameters(WorkloadParameters_t *parameters);
+
+//Writes numberOfProcesses processes in the input file format, sorted by arrival time (so the file can be streamed).
+//Exits if an arrival time no longer fits in an int.
+void generateWorkload(FILE *file, long long numberOfProcesses, const WorkloadParameters_t *parameters);
+
+#endif //WORKLOAD_H